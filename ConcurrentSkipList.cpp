@@ -0,0 +1,522 @@
+/*
+ConcurrentSkipList.cpp
+*/
+
+// Function purpose: Initilize a SkipListNode
+// Parameters: An item to copy or move into the node and the number of levels the node occupies
+// Preconditions: height is > 0 and storage for height forward pointers follows the node
+// Postconditions: An initilized SkipListNode with all forward pointers set to nullptr
+// Return value: N/A
+// Functions called: N/A
+template<class T>
+template<class U>
+ConcurrentSkipList<T>::SkipListNode::SkipListNode(U&& data, int height) : data_(std::forward<U>(data)) {
+   this->height_ = height;
+   this->isHead_ = false;
+   this->owners_.store(2, memory_order_relaxed);
+   for (int i = 0; i < height; i++) {
+      new (&next(i)) atomic<uintptr_t>(0);
+   }
+}
+
+// Function purpose: Initilize the head SkipListNode, which holds no item
+// Parameters: The number of levels the node occupies
+// Preconditions: storage for height forward pointers follows the node
+// Postconditions: An initilized SkipListNode with all forward pointers set to nullptr
+// Return value: N/A
+// Functions called: N/A
+template<class T>
+ConcurrentSkipList<T>::SkipListNode::SkipListNode(int height) {
+   this->height_ = height;
+   this->isHead_ = true;
+   this->owners_.store(0, memory_order_relaxed);
+   for (int i = 0; i < height; i++) {
+      new (&next(i)) atomic<uintptr_t>(0);
+   }
+}
+
+// Function purpose: To destroy a SkipListNode; the item is destroyed by destroyNode
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: N/A
+// Functions called: N/A
+template<class T>
+ConcurrentSkipList<T>::SkipListNode::~SkipListNode() {}
+
+// Function purpose: To access the forward pointer of the node at a given level
+// Parameters: An int for the level
+// Preconditions: 0 <= level < height_
+// Postconditions: N/A
+// Return value: reference to the marked forward pointer
+// Functions called: N/A
+template<class T>
+atomic<uintptr_t>& ConcurrentSkipList<T>::SkipListNode::next(int level) {
+   return reinterpret_cast<atomic<uintptr_t>*>(this + 1)[level];
+}
+
+// Function purpose: To construct an iterator for the ConcurrentSkipList
+// Parameters: A pointer to a ConcurrentSkipList and a pointer to one of its SkipListNodes
+// Preconditions: Initialized ConcurrentSkipList
+// Postconditions: Iterator located at SkipListNode; the calling thread is pinned while it exists
+// Return value: N/A
+// Functions called: N/A
+template<class T>
+ConcurrentSkipList<T>::iterator::iterator(const ConcurrentSkipList<T> *skpPtr, SkipListNode *nodePtr) {
+   this->skpPtr_ = skpPtr;
+   this->nodePtr_ = nodePtr;
+}
+
+// Function purpose: To return the item stored in nodePtr_
+// Parameters: N/A
+// Preconditions: Initialized iterator that is not end()
+// Postconditions: Item stored at location in ConcurrentSkipList
+// Return value: const reference to type <T>
+// Functions called: N/A
+template<class T>
+const T& ConcurrentSkipList<T>::iterator::operator*() const {
+   return nodePtr_->data_;
+}
+
+// Function purpose: To increment the iterator to the next item that has not been erased
+// Parameters: N/A
+// Preconditions: Initialized iterator that is not end()
+// Postconditions: Incremented iterator
+// Return value: iterator
+// Functions called: firstLive
+template<class T>
+typename ConcurrentSkipList<T>::iterator& ConcurrentSkipList<T>::iterator::operator++() {
+   nodePtr_ = firstLive(pointerOf(nodePtr_->next(0).load()));
+   return (*this);
+}
+
+// Function purpose: To return the current iterator, then increment it (postfix incrementation)
+// Parameters: N/A
+// Preconditions: Initialized iterator that is not end()
+// Postconditions: Iterator located at the current position of iterator before it was incremented
+// Return value: iterator
+// Functions called: N/A
+template<class T>
+typename ConcurrentSkipList<T>::iterator ConcurrentSkipList<T>::iterator::operator++(int) {
+   iterator temp = *this;
+   ++(*this);
+   return temp;
+}
+
+// Function purpose: To determine whether two iterators are at the same location (equal)
+// Parameters: N/A
+// Preconditions: An initialized iterator
+// Postconditions: bool reflecting whether two iterators are at the same location
+// Return value: bool
+// Functions called: N/A
+template<class T>
+bool ConcurrentSkipList<T>::iterator::operator==(const iterator& rhs) const {
+   return (skpPtr_ == rhs.skpPtr_) && (nodePtr_ == rhs.nodePtr_);
+}
+
+// Function purpose: To determine whether two iterators are not at the same location (not equal)
+// Parameters: N/A
+// Preconditions: An initialized iterator
+// Postconditions: bool reflecting whether two iterators are not at the same location
+// Return value: bool
+// Functions called: operator==
+template<class T>
+bool ConcurrentSkipList<T>::iterator::operator!=(const iterator& rhs) const {
+   return !(*this == rhs);
+}
+
+// Function purpose: To initialize a ConcurrentSkipList object
+// Parameters: N/A
+// Preconditions: ConcurrentSkipList.h has been included in the driver file
+// Postconditions: An empty ConcurrentSkipList
+// Return value: N/A
+// Functions called: createNode
+template<class T>
+ConcurrentSkipList<T>::ConcurrentSkipList() : topLevel_(1), size_(0) {
+   // Constructing the reclaimer first guarantees that it outlives lists with static storage
+   EpochReclaimer::instance();
+   void *block = ::operator new(sizeof(SkipListNode) + MAX_LEVEL * sizeof(atomic<uintptr_t>));
+   head_ = new (block) SkipListNode(MAX_LEVEL);
+}
+
+// Function purpose: To initialilize a ConcurrentSkipList using initializer_list
+// Parameters: an initilization list
+// Preconditions: N/A
+// Postconditions: initilized ConcurrentSkipList
+// Return value: N/A
+// Functions called: insert
+template<class T>
+ConcurrentSkipList<T>::ConcurrentSkipList(initializer_list<T> vals) : ConcurrentSkipList() {
+   for (const T &i : vals) {
+      insert(i);
+   }
+}
+
+// Function purpose: To destroy a ConcurrentSkipList object
+// Parameters: N/A
+// Preconditions: No other thread is using the ConcurrentSkipList
+// Postconditions: ConcurrentSkipList no longer exists in memory
+// Return value: N/A
+// Functions called: destroyNode
+template<class T>
+ConcurrentSkipList<T>::~ConcurrentSkipList() {
+   // Nodes still on the lowest level have not been retired; retired nodes belong to the EpochReclaimer
+   SkipListNode *curr = pointerOf(head_->next(0).load());
+   while (curr != nullptr) {
+      SkipListNode *next = pointerOf(curr->next(0).load());
+      destroyNode(curr);
+      curr = next;
+   }
+   destroyNode(head_);
+}
+
+// Function purpose: To allocate a SkipListNode and its forward pointers in a single block
+// Parameters: The item to copy or move into the node and the number of levels the node occupies
+// Preconditions: height is > 0
+// Postconditions: A SkipListNode that is not linked into any level
+// Return value: SkipListNode pointer
+// Functions called: N/A
+template<class T>
+template<class U>
+typename ConcurrentSkipList<T>::SkipListNode* ConcurrentSkipList<T>::createNode(U&& data, int height) {
+   void *block = ::operator new(sizeof(SkipListNode) + height * sizeof(atomic<uintptr_t>));
+   try {
+      return new (block) SkipListNode(std::forward<U>(data), height);
+   }
+   catch (...) {
+      ::operator delete(block);
+      throw;
+   }
+}
+
+// Function purpose: To destroy a SkipListNode and release its block
+// Parameters: A SkipListNode pointer
+// Preconditions: No thread can reach the node
+// Postconditions: The node no longer exists in memory
+// Return value: void
+// Functions called: N/A
+template<class T>
+void ConcurrentSkipList<T>::destroyNode(SkipListNode *node) {
+   if (!node->isHead_) { node->data_.~T(); }
+   node->~SkipListNode();
+   ::operator delete(static_cast<void*>(node));
+}
+
+// Function purpose: To destroy a retired SkipListNode on behalf of the EpochReclaimer
+// Parameters: The node as a void pointer
+// Preconditions: No thread can reach the node
+// Postconditions: The node no longer exists in memory
+// Return value: void
+// Functions called: destroyNode
+template<class T>
+void ConcurrentSkipList<T>::reclaimNode(void *node) {
+   destroyNode(static_cast<SkipListNode*>(node));
+}
+
+// Function purpose: To drop one owner of a node and retire it when no owner is left
+// Parameters: A SkipListNode pointer
+// Preconditions: The caller is an owner and has finished linking or unlinking the node
+// Postconditions: The node is retired if this was the last owner
+// Return value: void
+// Functions called: EpochReclaimer::retire
+template<class T>
+void ConcurrentSkipList<T>::releaseNode(SkipListNode *node) {
+   if (node->owners_.fetch_sub(1) == 1) {
+      EpochReclaimer::instance().retire(node, &reclaimNode);
+   }
+}
+
+// Function purpose: To separate a marked forward pointer into its node and its mark
+// Parameters: A marked forward pointer
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: SkipListNode pointer or bool
+// Functions called: N/A
+template<class T>
+typename ConcurrentSkipList<T>::SkipListNode* ConcurrentSkipList<T>::pointerOf(uintptr_t link) {
+   return reinterpret_cast<SkipListNode*>(link & ~MARK);
+}
+
+template<class T>
+bool ConcurrentSkipList<T>::isMarked(uintptr_t link) {
+   return (link & MARK) != 0;
+}
+
+// Function purpose: To find the last node before an item on every level, unlinking marked nodes on the way
+// Parameters: An item, arrays of MAX_LEVEL entries for predecessors and successors, and the number of
+// levels to search
+// Preconditions: Calling thread holds an EpochReclaimer::Guard
+// Postconditions: beforeNodes[i] < data <= afterNodes[i] on every searched level i
+// Return value: bool reflecting whether afterNodes[0] holds the item
+// Functions called: pointerOf, isMarked
+template<class T>
+bool ConcurrentSkipList<T>::findPredecessors(const T& data, SkipListNode **beforeNodes, SkipListNode **afterNodes,
+      int levels) const {
+   bool restart = true;
+   SkipListNode *curr = nullptr;
+   while (restart) {
+      restart = false;
+      SkipListNode *pred = head_;
+      for (int i = levels - 1; i >= 0 && !restart; i--) {
+         curr = pointerOf(pred->next(i).load());
+         while (curr != nullptr) {
+            uintptr_t succ = curr->next(i).load();
+            if (isMarked(succ)) {
+               // curr has been erased; unlink it from this level or start over if pred changed
+               uintptr_t expected = reinterpret_cast<uintptr_t>(curr);
+               if (!pred->next(i).compare_exchange_strong(expected, succ & ~MARK)) {
+                  restart = true;
+                  break;
+               }
+               curr = pointerOf(succ);
+            }
+            else if (curr->data_ < data) {
+               pred = curr;
+               curr = pointerOf(succ);
+            }
+            else {
+               break;
+            }
+         }
+         beforeNodes[i] = pred;
+         afterNodes[i] = curr;
+      }
+   }
+   return curr != nullptr && !(data < curr->data_);
+}
+
+// Function purpose: To choose the number of levels a new SkipListNode occupies
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: A height between 1 and MAX_LEVEL has been returned
+// Return value: int
+// Functions called: LevelGenerator::height
+template<class T>
+int ConcurrentSkipList<T>::randomHeight() {
+   // One generator per thread; the seed is mixed with the thread identity so that threads differ
+   thread_local LevelGenerator generator(LevelGenerator::HALF,
+      LevelGenerator::DEFAULT_SEED ^ hash<thread::id>()(this_thread::get_id()));
+   return generator.height(MAX_LEVEL);
+}
+
+// Function purpose: To return the first node on the lowest level that has not been erased
+// Parameters: A SkipListNode pointer to start from
+// Preconditions: Calling thread holds an EpochReclaimer::Guard
+// Postconditions: N/A
+// Return value: SkipListNode pointer or nullptr
+// Functions called: pointerOf, isMarked
+template<class T>
+typename ConcurrentSkipList<T>::SkipListNode* ConcurrentSkipList<T>::firstLive(SkipListNode *node) {
+   while (node != nullptr) {
+      uintptr_t succ = node->next(0).load();
+      if (!isMarked(succ)) { return node; }
+      node = pointerOf(succ);
+   }
+   return nullptr;
+}
+
+// Function purpose: To add a SkipListNode containing a unique item to a ConcurrentSkipList
+// Parameters: An item to copy or move into the ConcurrentSkipList
+// Preconditions: Initialized ConcurrentSkipList
+// Postconditions: The item is in the ConcurrentSkipList unless another thread erased it meanwhile
+// Return value: pair of an iterator to the item and a bool that is true if the item was inserted
+// Functions called: insertUnique
+template<class T>
+pair<typename ConcurrentSkipList<T>::iterator, bool> ConcurrentSkipList<T>::insert(const T& data) {
+   return insertUnique(data);
+}
+
+template<class T>
+pair<typename ConcurrentSkipList<T>::iterator, bool> ConcurrentSkipList<T>::insert(T&& data) {
+   return insertUnique(std::move(data));
+}
+
+// Function purpose: To add an item unless an equal item is in the ConcurrentSkipList
+// Parameters: An item, forwarded so that an rvalue is moved into the new node
+// Preconditions: Initialized ConcurrentSkipList
+// Postconditions: The item is in the ConcurrentSkipList unless another thread erased it meanwhile; data 
+// is left untouched if an equal item was found before the node was built
+// Return value: pair of an iterator to the item and a bool that is true if the item was inserted
+// Functions called: randomHeight, findPredecessors, createNode, releaseNode
+template<class T>
+template<class U>
+pair<typename ConcurrentSkipList<T>::iterator, bool> ConcurrentSkipList<T>::insertUnique(U&& data) {
+   EpochReclaimer::Guard guard;
+   SkipListNode *beforeNodes[MAX_LEVEL];
+   SkipListNode *afterNodes[MAX_LEVEL];
+   int height = randomHeight();
+
+   // Raising the level count before linking keeps every linked level inside the range searched by others
+   int top = topLevel_.load();
+   while (top < height && !topLevel_.compare_exchange_weak(top, height)) {}
+   int levels = (top > height) ? top : height;
+
+   SkipListNode *newValue = nullptr;
+   while (true) {
+      // Once data has been moved into the node, the node's copy is the one to search for
+      const T &key = (newValue == nullptr) ? data : newValue->data_;
+      if (findPredecessors(key, beforeNodes, afterNodes, levels)) {
+         if (newValue != nullptr) { destroyNode(newValue); }
+         return make_pair(iterator(this, afterNodes[0]), false);
+      }
+      if (newValue == nullptr) { newValue = createNode(std::forward<U>(data), height); }
+      for (int i = 0; i < height; i++) {
+         newValue->next(i).store(reinterpret_cast<uintptr_t>(afterNodes[i]), memory_order_relaxed);
+      }
+      // Linking the lowest level is the point at which the item becomes part of the set
+      uintptr_t expected = reinterpret_cast<uintptr_t>(afterNodes[0]);
+      if (beforeNodes[0]->next(0).compare_exchange_strong(expected, reinterpret_cast<uintptr_t>(newValue))) {
+         break;
+      }
+   }
+   size_.fetch_add(1);
+
+   bool linking = true;
+   for (int i = 1; i < height && linking; i++) {
+      while (true) {
+         uintptr_t link = newValue->next(i).load();
+         if (isMarked(link)) {
+            // An eraser has claimed the node; stop raising it
+            linking = false;
+            break;
+         }
+         uintptr_t wanted = reinterpret_cast<uintptr_t>(afterNodes[i]);
+         if (link != wanted && !newValue->next(i).compare_exchange_strong(link, wanted)) {
+            continue;
+         }
+         uintptr_t expected = wanted;
+         if (beforeNodes[i]->next(i).compare_exchange_strong(expected, reinterpret_cast<uintptr_t>(newValue))) {
+            break;
+         }
+         findPredecessors(newValue->data_, beforeNodes, afterNodes, levels);
+         if (afterNodes[0] != newValue) {
+            // The node was erased and unlinked from the lowest level while it was being raised
+            linking = false;
+            break;
+         }
+      }
+   }
+   if (isMarked(newValue->next(0).load())) {
+      // An eraser may have finished before the last level was linked; unlink what was added since
+      findPredecessors(newValue->data_, beforeNodes, afterNodes, levels);
+   }
+   iterator result(this, newValue);
+   releaseNode(newValue);
+   return make_pair(result, true);
+}
+
+// Function purpose: To check if the ConcurrentSkipList contains a given item
+// Parameters: An item to search for
+// Preconditions: Initialized ConcurrentSkipList
+// Postconditions: A bool reflecting the existance of the item in the ConcurrentSkipList
+// Return value: bool
+// Functions called: pointerOf, isMarked
+template<class T>
+bool ConcurrentSkipList<T>::contains(const T& data) const {
+   EpochReclaimer::Guard guard;
+   SkipListNode *pred = head_;
+   SkipListNode *curr = nullptr;
+   // Erased nodes are walked through rather than unlinked, so lookups never write or restart
+   for (int i = topLevel_.load() - 1; i >= 0; i--) {
+      curr = pointerOf(pred->next(i).load());
+      while (curr != nullptr && curr->data_ < data) {
+         pred = curr;
+         curr = pointerOf(curr->next(i).load());
+      }
+   }
+   return curr != nullptr && !(data < curr->data_) && !isMarked(curr->next(0).load());
+}
+
+// Function purpose: To remove the SkipListNode containing a given item from the ConcurrentSkipList
+// Parameters: An item that may be stored in the ConcurrentSkipList
+// Preconditions: Initialized ConcurrentSkipList
+// Postconditions: The item is no longer in the ConcurrentSkipList unless another thread inserted it meanwhile
+// Return value: int for the number of items removed by this call (0 or 1)
+// Functions called: findPredecessors, releaseNode
+template<class T>
+int ConcurrentSkipList<T>::erase(const T& data) {
+   EpochReclaimer::Guard guard;
+   SkipListNode *beforeNodes[MAX_LEVEL];
+   SkipListNode *afterNodes[MAX_LEVEL];
+   int levels = topLevel_.load();
+   if (!findPredecessors(data, beforeNodes, afterNodes, levels)) {
+      return 0;
+   }
+   SkipListNode *toDelete = afterNodes[0];
+   for (int i = toDelete->height_ - 1; i > 0; i--) {
+      uintptr_t link = toDelete->next(i).load();
+      while (!isMarked(link) && !toDelete->next(i).compare_exchange_weak(link, link | MARK)) {}
+   }
+   // Whoever marks the lowest level owns the deletion
+   uintptr_t link = toDelete->next(0).load();
+   while (true) {
+      if (isMarked(link)) { return 0; }
+      if (toDelete->next(0).compare_exchange_weak(link, link | MARK)) { break; }
+   }
+   size_.fetch_sub(1);
+   int height = toDelete->height_;
+   findPredecessors(data, beforeNodes, afterNodes, (levels > height) ? levels : height);
+   releaseNode(toDelete);
+   return 1;
+}
+
+// Function purpose: To return the number of items in the ConcurrentSkipList
+// Parameters: N/A
+// Preconditions: Initialized ConcurrentSkipList
+// Postconditions: N/A
+// Return value: int
+// Functions called: N/A
+template<class T>
+int ConcurrentSkipList<T>::size() const {
+   return size_.load();
+}
+
+// Function purpose: To indicate whether a ConcurrentSkipList is empty
+// Parameters: N/A
+// Preconditions: Initialized ConcurrentSkipList
+// Postconditions: A bool reflecting whether ConcurrentSkipList is empty
+// Return value: bool
+// Functions called: size
+template<class T>
+bool ConcurrentSkipList<T>::empty() const {
+   return size() == 0;
+}
+
+// Function purpose: To erase every item of the ConcurrentSkipList
+// Parameters: N/A
+// Preconditions: Initialized ConcurrentSkipList
+// Postconditions: Every item present when clear started has been erased
+// Return value: void
+// Functions called: erase, firstLive
+template<class T>
+void ConcurrentSkipList<T>::clear() {
+   EpochReclaimer::Guard guard;
+   SkipListNode *curr = firstLive(pointerOf(head_->next(0).load()));
+   while (curr != nullptr) {
+      erase(curr->data_);
+      curr = firstLive(pointerOf(curr->next(0).load()));
+   }
+}
+
+// Function purpose: To return an iterator set to the first item of the ConcurrentSkipList
+// Parameters: N/A
+// Preconditions: Initialized ConcurrentSkipList
+// Postconditions: An iterator at the beginning of the ConcurrentSkipList
+// Return value: iterator
+// Functions called: firstLive
+template<class T>
+typename ConcurrentSkipList<T>::iterator ConcurrentSkipList<T>::begin() const {
+   EpochReclaimer::Guard guard;
+   return iterator(this, firstLive(pointerOf(head_->next(0).load())));
+}
+
+// Function purpose: To return an iterator set past the last item of the ConcurrentSkipList
+// Parameters: N/A
+// Preconditions: Initialized ConcurrentSkipList
+// Postconditions: An iterator at the end of the ConcurrentSkipList
+// Return value: iterator
+// Functions called: N/A
+template<class T>
+typename ConcurrentSkipList<T>::iterator ConcurrentSkipList<T>::end() const {
+   return iterator(this, nullptr);
+}
@@ -0,0 +1,346 @@
+/*
+ConcurrentSkipList.h
+
+Input & output: insert, erase, and contains may be called on one ConcurrentSkipList from any number of
+threads at the same time without external locking. insert returns a pair holding an iterator to the item
+and a bool that is true if the parameter was inserted, erase returns the number of items removed (0 or 1),
+and contains returns true if the parameter exists in the ConcurrentSkipList.
+Program use:
+To use the program, include ConcurrentSkipList.h in the driver file.
+Initialization: ConcurrentSkipList<type> objectName; Use of initializer_list is also supported.
+Insertion: objectName.insert(type); Only unique values may be added to the ConcurrentSkipList
+Deletion: objectName.erase(type);
+Check if item is in ConcurrentSkipList: objectName.contains(type);
+Assumptions:
+T must be copy-constructible and ordered by operator<. Construction, destruction and assignment of the
+ConcurrentSkipList itself are not thread-safe. An iterator keeps its thread pinned in the EpochReclaimer
+while it exists, so it must not be handed to another thread and should not be kept for long periods.
+size() is exact when no operation is in progress.
+Description:
+The structure follows the lock-free skip list of Fraser and of Herlihy and Shavit. Each item is stored in a
+single node holding an inline array of atomic forward pointers. The lowest bit of a forward pointer marks
+the node that owns it as deleted at that level. erase marks the levels of a node from the top down and the
+thread that marks the lowest level owns the deletion; any thread that later walks past a marked node
+unlinks it with compare-and-swap. insert links the lowest level first, which is the moment the item
+becomes visible, and then the upper levels. contains never writes and never retries.
+Unlinked nodes are handed to the EpochReclaimer, which destroys them once no thread can still hold a
+pointer to them. Because the inserting thread may still be linking upper levels when a node is erased, a
+node is only retired after both its inserter and its eraser have finished with it.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <functional>
+#include <thread>
+#include <utility>
+#include "EpochReclaimer.h"
+#include "LevelGenerator.h"
+
+using namespace std;
+
+template<class T>
+
+class ConcurrentSkipList {
+
+private:
+
+   struct alignas(atomic<uintptr_t>) SkipListNode {
+      // Function purpose: Initilize a SkipListNode
+      // Parameters: An item to copy or move into the node and the number of levels the node occupies
+      // Preconditions: height is > 0 and storage for height forward pointers follows the node
+      // Postconditions: An initilized SkipListNode with all forward pointers set to nullptr
+      // Return value: N/A
+      // Functions called: N/A
+      template<class U>
+      SkipListNode(U&& data, int height);
+
+      // Function purpose: Initilize the head SkipListNode, which holds no item
+      // Parameters: The number of levels the node occupies
+      // Preconditions: storage for height forward pointers follows the node
+      // Postconditions: An initilized SkipListNode with all forward pointers set to nullptr
+      // Return value: N/A
+      // Functions called: N/A
+      explicit SkipListNode(int height);
+
+      // Function purpose: To destroy a SkipListNode; the item is destroyed by destroyNode
+      // Parameters: N/A
+      // Preconditions: N/A
+      // Postconditions: N/A
+      // Return value: N/A
+      // Functions called: N/A
+      ~SkipListNode();
+
+      // Function purpose: To access the forward pointer of the node at a given level
+      // Parameters: An int for the level
+      // Preconditions: 0 <= level < height_
+      // Postconditions: N/A
+      // Return value: reference to the marked forward pointer
+      // Functions called: N/A
+      atomic<uintptr_t>& next(int level);
+
+      union {
+         T data_;
+      };
+      int height_;
+      bool isHead_;
+      // Number of threads (inserter and eraser) that still use the node; it is retired at zero
+      atomic<int> owners_;
+      // height_ forward pointers are stored directly after the node in the same allocation
+   };
+
+   static const uintptr_t MARK = 1;
+
+public:
+
+   // Upper bound on the number of levels; enough for 2^32 items at a promotion chance of 50%
+   static constexpr int MAX_LEVEL = 32;
+
+private:
+
+   SkipListNode *head_;
+   atomic<int> topLevel_;
+   atomic<int> size_;
+
+   // Function purpose: To allocate a SkipListNode and its forward pointers in a single block
+   // Parameters: The item to copy or move into the node and the number of levels the node occupies
+   // Preconditions: height is > 0
+   // Postconditions: A SkipListNode that is not linked into any level
+   // Return value: SkipListNode pointer
+   // Functions called: N/A
+   template<class U>
+   static SkipListNode* createNode(U&& data, int height);
+
+   // Function purpose: To destroy a SkipListNode and release its block
+   // Parameters: A SkipListNode pointer
+   // Preconditions: No thread can reach the node
+   // Postconditions: The node no longer exists in memory
+   // Return value: void
+   // Functions called: N/A
+   static void destroyNode(SkipListNode *node);
+
+   // Function purpose: To destroy a retired SkipListNode on behalf of the EpochReclaimer
+   // Parameters: The node as a void pointer
+   // Preconditions: No thread can reach the node
+   // Postconditions: The node no longer exists in memory
+   // Return value: void
+   // Functions called: destroyNode
+   static void reclaimNode(void *node);
+
+   // Function purpose: To drop one owner of a node and retire it when no owner is left
+   // Parameters: A SkipListNode pointer
+   // Preconditions: The caller is an owner and has finished linking or unlinking the node
+   // Postconditions: The node is retired if this was the last owner
+   // Return value: void
+   // Functions called: EpochReclaimer::retire
+   static void releaseNode(SkipListNode *node);
+
+   // Function purpose: To separate a marked forward pointer into its node and its mark
+   // Parameters: A marked forward pointer
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: SkipListNode pointer or bool
+   // Functions called: N/A
+   static SkipListNode* pointerOf(uintptr_t link);
+   static bool isMarked(uintptr_t link);
+
+   // Function purpose: To find the last node before an item on every level, unlinking marked nodes on the way
+   // Parameters: An item, arrays of MAX_LEVEL entries for predecessors and successors, and the number of
+   // levels to search
+   // Preconditions: Calling thread holds an EpochReclaimer::Guard
+   // Postconditions: beforeNodes[i] < data <= afterNodes[i] on every searched level i
+   // Return value: bool reflecting whether afterNodes[0] holds the item
+   // Functions called: pointerOf, isMarked
+   bool findPredecessors(const T& data, SkipListNode **beforeNodes, SkipListNode **afterNodes,
+      int levels) const;
+
+   // Function purpose: To choose the number of levels a new SkipListNode occupies
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: A height between 1 and MAX_LEVEL has been returned
+   // Return value: int
+   // Functions called: LevelGenerator::height
+   static int randomHeight();
+
+   // Function purpose: To return the first node on the lowest level that has not been erased
+   // Parameters: A SkipListNode pointer to start from
+   // Preconditions: Calling thread holds an EpochReclaimer::Guard
+   // Postconditions: N/A
+   // Return value: SkipListNode pointer or nullptr
+   // Functions called: pointerOf, isMarked
+   static SkipListNode* firstLive(SkipListNode *node);
+
+public:
+
+   class iterator {
+      public:
+      using iterator_category = std::forward_iterator_tag;
+      using difference_type = std::ptrdiff_t;
+      using value_type = T;
+      using pointer = const T*;
+      using reference = const T&;
+
+      // Function purpose: To construct an iterator for the ConcurrentSkipList
+      // Parameters: A pointer to a ConcurrentSkipList and a pointer to one of its SkipListNodes
+      // Preconditions: Initialized ConcurrentSkipList
+      // Postconditions: Iterator located at SkipListNode; the calling thread is pinned while it exists
+      // Return value: N/A
+      // Functions called: N/A
+      iterator(const ConcurrentSkipList<T> *skpPtr, SkipListNode *nodePtr = nullptr);
+
+      // Function purpose: To return the item stored in nodePtr_
+      // Parameters: N/A
+      // Preconditions: Initialized iterator that is not end()
+      // Postconditions: Item stored at location in ConcurrentSkipList
+      // Return value: const reference to type <T>
+      // Functions called: N/A
+      const T& operator*() const;
+
+      // Function purpose: To increment the iterator to the next item that has not been erased
+      // Parameters: N/A
+      // Preconditions: Initialized iterator that is not end()
+      // Postconditions: Incremented iterator
+      // Return value: iterator
+      // Functions called: firstLive
+      iterator& operator++();
+
+      // Function purpose: To return the current iterator, then increment it (postfix incrementation)
+      // Parameters: N/A
+      // Preconditions: Initialized iterator that is not end()
+      // Postconditions: Iterator located at the current position of iterator before it was incremented
+      // Return value: iterator
+      // Functions called: N/A
+      iterator operator++(int);
+
+      // Function purpose: To determine whether two iterators are at the same location (equal)
+      // Parameters: N/A
+      // Preconditions: An initialized iterator
+      // Postconditions: bool reflecting whether two iterators are at the same location
+      // Return value: bool
+      // Functions called: N/A
+      bool operator==(const iterator& rhs) const;
+
+      // Function purpose: To determine whether two iterators are not at the same location (not equal)
+      // Parameters: N/A
+      // Preconditions: An initialized iterator
+      // Postconditions: bool reflecting whether two iterators are not at the same location
+      // Return value: bool
+      // Functions called: operator==
+      bool operator!=(const iterator& rhs) const;
+      private:
+      EpochReclaimer::Guard guard_;
+      const ConcurrentSkipList<T> *skpPtr_;
+      SkipListNode *nodePtr_;
+   };
+
+   // Function purpose: To initialize a ConcurrentSkipList object
+   // Parameters: N/A
+   // Preconditions: ConcurrentSkipList.h has been included in the driver file
+   // Postconditions: An empty ConcurrentSkipList
+   // Return value: N/A
+   // Functions called: createNode
+   ConcurrentSkipList();
+
+   // Function purpose: To initialilize a ConcurrentSkipList using initializer_list
+   // Parameters: an initilization list
+   // Preconditions: N/A
+   // Postconditions: initilized ConcurrentSkipList
+   // Return value: N/A
+   // Functions called: insert
+   ConcurrentSkipList(initializer_list<T> vals);
+
+   // Function purpose: To destroy a ConcurrentSkipList object
+   // Parameters: N/A
+   // Preconditions: No other thread is using the ConcurrentSkipList
+   // Postconditions: ConcurrentSkipList no longer exists in memory
+   // Return value: N/A
+   // Functions called: destroyNode
+   ~ConcurrentSkipList();
+
+   ConcurrentSkipList(const ConcurrentSkipList&) = delete;
+   ConcurrentSkipList& operator=(const ConcurrentSkipList&) = delete;
+
+   // Function purpose: To add a SkipListNode containing a unique item to a ConcurrentSkipList
+   // Parameters: An item to copy or move into the ConcurrentSkipList
+   // Preconditions: Initialized ConcurrentSkipList
+   // Postconditions: The item is in the ConcurrentSkipList unless another thread erased it meanwhile
+   // Return value: pair of an iterator to the item and a bool that is true if the item was inserted
+   // Functions called: insertUnique
+   pair<iterator, bool> insert(const T& data);
+   pair<iterator, bool> insert(T&& data);
+
+   // Function purpose: To check if the ConcurrentSkipList contains a given item
+   // Parameters: An item to search for
+   // Preconditions: Initialized ConcurrentSkipList
+   // Postconditions: A bool reflecting the existance of the item in the ConcurrentSkipList
+   // Return value: bool
+   // Functions called: pointerOf, isMarked
+   bool contains(const T& data) const;
+
+   // Function purpose: To remove the SkipListNode containing a given item from the ConcurrentSkipList
+   // Parameters: An item that may be stored in the ConcurrentSkipList
+   // Preconditions: Initialized ConcurrentSkipList
+   // Postconditions: The item is no longer in the ConcurrentSkipList unless another thread inserted it meanwhile
+   // Return value: int for the number of items removed by this call (0 or 1)
+   // Functions called: findPredecessors, releaseNode
+   int erase(const T& data);
+
+   // Function purpose: To return the number of items in the ConcurrentSkipList
+   // Parameters: N/A
+   // Preconditions: Initialized ConcurrentSkipList
+   // Postconditions: N/A
+   // Return value: int
+   // Functions called: N/A
+   int size() const;
+
+   // Function purpose: To indicate whether a ConcurrentSkipList is empty
+   // Parameters: N/A
+   // Preconditions: Initialized ConcurrentSkipList
+   // Postconditions: A bool reflecting whether ConcurrentSkipList is empty
+   // Return value: bool
+   // Functions called: size
+   bool empty() const;
+
+   // Function purpose: To erase every item of the ConcurrentSkipList
+   // Parameters: N/A
+   // Preconditions: Initialized ConcurrentSkipList
+   // Postconditions: Every item present when clear started has been erased
+   // Return value: void
+   // Functions called: erase, firstLive
+   void clear();
+
+   // Function purpose: To return an iterator set to the first item of the ConcurrentSkipList
+   // Parameters: N/A
+   // Preconditions: Initialized ConcurrentSkipList
+   // Postconditions: An iterator at the beginning of the ConcurrentSkipList
+   // Return value: iterator
+   // Functions called: firstLive
+   iterator begin() const;
+
+   // Function purpose: To return an iterator set past the last item of the ConcurrentSkipList
+   // Parameters: N/A
+   // Preconditions: Initialized ConcurrentSkipList
+   // Postconditions: An iterator at the end of the ConcurrentSkipList
+   // Return value: iterator
+   // Functions called: N/A
+   iterator end() const;
+
+private:
+
+   // Function purpose: To add an item unless an equal item is in the ConcurrentSkipList
+   // Parameters: An item, forwarded so that an rvalue is moved into the new node
+   // Preconditions: Initialized ConcurrentSkipList
+   // Postconditions: The item is in the ConcurrentSkipList unless another thread erased it meanwhile; data 
+   // is left untouched if an equal item was found before the node was built
+   // Return value: pair of an iterator to the item and a bool that is true if the item was inserted
+   // Functions called: randomHeight, findPredecessors, createNode, releaseNode
+   template<class U>
+   pair<iterator, bool> insertUnique(U&& data);
+
+};
+
+#include "ConcurrentSkipList.cpp"
@@ -0,0 +1,199 @@
+/*
+EpochReclaimer.cpp
+*/
+
+// Function purpose: To pin the calling thread to the current epoch
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: Nodes reachable from now on are not destroyed until the Guard is destroyed
+// Return value: N/A
+// Functions called: EpochReclaimer::enter
+inline EpochReclaimer::Guard::Guard() {
+   EpochReclaimer::instance().enter();
+}
+
+// Function purpose: To copy a Guard within the same thread
+// Parameters: A Guard
+// Preconditions: toCopy belongs to the calling thread
+// Postconditions: The calling thread stays pinned until both Guards are destroyed
+// Return value: N/A
+// Functions called: EpochReclaimer::enter
+inline EpochReclaimer::Guard::Guard(const Guard&) {
+   EpochReclaimer::instance().enter();
+}
+
+// Function purpose: To release the pin taken by the Guard
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: The calling thread is unpinned if this was its last Guard
+// Return value: N/A
+// Functions called: EpochReclaimer::exit
+inline EpochReclaimer::Guard::~Guard() {
+   EpochReclaimer::instance().exit();
+}
+
+// Function purpose: To release the record of a thread that is exiting
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: The record may be claimed by another thread
+// Return value: N/A
+// Functions called: N/A
+inline EpochReclaimer::RecordHolder::~RecordHolder() {
+   if (record_ != nullptr) {
+      record_->nesting_ = 0;
+      record_->state_.store(0);
+      record_->inUse_.store(false);
+   }
+}
+
+// Function purpose: To initialize an EpochReclaimer with no thread records
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: Global epoch is 0
+// Return value: N/A
+// Functions called: N/A
+inline EpochReclaimer::EpochReclaimer() : globalEpoch_(0), records_(nullptr) {}
+
+// Function purpose: To destroy every object that is still waiting
+// Parameters: N/A
+// Preconditions: No thread is inside a Guard
+// Postconditions: EpochReclaimer no longer exists in memory
+// Return value: N/A
+// Functions called: N/A
+inline EpochReclaimer::~EpochReclaimer() {
+   ThreadRecord *record = records_.load();
+   while (record != nullptr) {
+      for (const Retired &item : record->retired_) {
+         item.destroy_(item.object_);
+      }
+      ThreadRecord *next = record->next_;
+      delete record;
+      record = next;
+   }
+}
+
+// Function purpose: To return the reclaimer shared by every lock-free structure in the program
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: reference to EpochReclaimer
+// Functions called: N/A
+inline EpochReclaimer& EpochReclaimer::instance() {
+   static EpochReclaimer reclaimer;
+   return reclaimer;
+}
+
+// Function purpose: To return the record of the calling thread, claiming one on first use
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: The record is owned by the calling thread until it exits
+// Return value: ThreadRecord pointer
+// Functions called: N/A
+inline EpochReclaimer::ThreadRecord* EpochReclaimer::localRecord() {
+   thread_local RecordHolder holder;
+   if (holder.record_ != nullptr) { return holder.record_; }
+
+   for (ThreadRecord *record = records_.load(); record != nullptr; record = record->next_) {
+      bool expected = false;
+      if (!record->inUse_.load() && record->inUse_.compare_exchange_strong(expected, true)) {
+         holder.record_ = record;
+         return record;
+      }
+   }
+   ThreadRecord *record = new ThreadRecord();
+   record->state_.store(0);
+   record->inUse_.store(true);
+   record->nesting_ = 0;
+   record->next_ = records_.load();
+   while (!records_.compare_exchange_weak(record->next_, record)) {}
+   holder.record_ = record;
+   return record;
+}
+
+// Function purpose: To pin the calling thread to the current epoch
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: Nesting count of the calling thread has been incremented
+// Return value: void
+// Functions called: localRecord
+inline void EpochReclaimer::enter() {
+   ThreadRecord *record = localRecord();
+   if (record->nesting_++ == 0) {
+      // Republish until the epoch is stable so that it cannot advance twice past the published value
+      uint64_t epoch = globalEpoch_.load();
+      while (true) {
+         record->state_.store((epoch << 1) | ACTIVE);
+         uint64_t current = globalEpoch_.load();
+         if (current == epoch) { break; }
+         epoch = current;
+      }
+   }
+}
+
+// Function purpose: To unpin the calling thread
+// Parameters: N/A
+// Preconditions: The calling thread is pinned
+// Postconditions: Nesting count of the calling thread has been decremented
+// Return value: void
+// Functions called: localRecord
+inline void EpochReclaimer::exit() {
+   ThreadRecord *record = localRecord();
+   if (--record->nesting_ == 0) {
+      record->state_.store(record->state_.load() & ~ACTIVE);
+   }
+}
+
+// Function purpose: To advance the global epoch if every pinned thread has observed it
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: void
+// Functions called: N/A
+inline void EpochReclaimer::tryAdvance() {
+   uint64_t epoch = globalEpoch_.load();
+   for (ThreadRecord *record = records_.load(); record != nullptr; record = record->next_) {
+      uint64_t state = record->state_.load();
+      if ((state & ACTIVE) && (state >> 1) != epoch) { return; }
+   }
+   globalEpoch_.compare_exchange_strong(epoch, epoch + 1);
+}
+
+// Function purpose: To destroy the objects of a record that can no longer be referenced
+// Parameters: A ThreadRecord pointer
+// Preconditions: The record belongs to the calling thread
+// Postconditions: Objects retired two or more epochs ago have been destroyed
+// Return value: void
+// Functions called: N/A
+inline void EpochReclaimer::collect(ThreadRecord *record) {
+   uint64_t epoch = globalEpoch_.load();
+   size_t kept = 0;
+   for (size_t i = 0; i < record->retired_.size(); i++) {
+      Retired item = record->retired_[i];
+      if (item.epoch_ + 2 <= epoch) {
+         item.destroy_(item.object_);
+      }
+      else {
+         record->retired_[kept++] = item;
+      }
+   }
+   record->retired_.resize(kept);
+}
+
+// Function purpose: To schedule an unlinked object for destruction
+// Parameters: The object and the function that destroys it
+// Preconditions: The object is no longer reachable by threads that enter a Guard from now on
+// Postconditions: destroy(object) is called once every thread that could see the object has left its Guard
+// Return value: void
+// Functions called: localRecord, tryAdvance, collect
+inline void EpochReclaimer::retire(void *object, void (*destroy)(void*)) {
+   ThreadRecord *record = localRecord();
+   Retired item;
+   item.object_ = object;
+   item.destroy_ = destroy;
+   item.epoch_ = globalEpoch_.load();
+   record->retired_.push_back(item);
+   if (record->retired_.size() % COLLECT_INTERVAL == 0) {
+      tryAdvance();
+      collect(record);
+   }
+}
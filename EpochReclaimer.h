@@ -0,0 +1,166 @@
+/*
+EpochReclaimer.h
+
+Input & output: EpochReclaimer defers the destruction of objects that have been unlinked from a lock-free
+structure until no thread can still be reading them. retire accepts an object and the function that
+destroys it.
+Program use:
+Every access to shared nodes must happen while the calling thread holds an EpochReclaimer::Guard:
+EpochReclaimer::Guard guard;
+Nodes are passed to EpochReclaimer::instance().retire(node, destroyFunction) once they are unreachable.
+Assumptions:
+A Guard is only used by the thread that created it. Guards may be nested and copied within a thread.
+Description:
+The reclaimer keeps a global epoch counter and one record per thread. Entering a guard publishes the
+current epoch in the record of the thread. The global epoch only advances when every thread inside a guard
+has observed it, so an object retired during epoch e cannot be referenced by any thread once the global
+epoch reaches e + 2, at which point it is destroyed. Records of threads that exit are reused by later
+threads together with any objects they still have waiting.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+class EpochReclaimer {
+
+public:
+
+   class Guard {
+   public:
+      // Function purpose: To pin the calling thread to the current epoch
+      // Parameters: N/A
+      // Preconditions: N/A
+      // Postconditions: Nodes reachable from now on are not destroyed until the Guard is destroyed
+      // Return value: N/A
+      // Functions called: EpochReclaimer::enter
+      Guard();
+
+      // Function purpose: To copy a Guard within the same thread
+      // Parameters: A Guard
+      // Preconditions: toCopy belongs to the calling thread
+      // Postconditions: The calling thread stays pinned until both Guards are destroyed
+      // Return value: N/A
+      // Functions called: EpochReclaimer::enter
+      Guard(const Guard& toCopy);
+
+      Guard& operator=(const Guard& rhs) = default;
+
+      // Function purpose: To release the pin taken by the Guard
+      // Parameters: N/A
+      // Preconditions: N/A
+      // Postconditions: The calling thread is unpinned if this was its last Guard
+      // Return value: N/A
+      // Functions called: EpochReclaimer::exit
+      ~Guard();
+   };
+
+   // Function purpose: To return the reclaimer shared by every lock-free structure in the program
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: reference to EpochReclaimer
+   // Functions called: N/A
+   static EpochReclaimer& instance();
+
+   // Function purpose: To schedule an unlinked object for destruction
+   // Parameters: The object and the function that destroys it
+   // Preconditions: The object is no longer reachable by threads that enter a Guard from now on
+   // Postconditions: destroy(object) is called once every thread that could see the object has left its Guard
+   // Return value: void
+   // Functions called: localRecord, tryAdvance, collect
+   void retire(void *object, void (*destroy)(void*));
+
+   // Function purpose: To destroy every object that is still waiting
+   // Parameters: N/A
+   // Preconditions: No thread is inside a Guard
+   // Postconditions: EpochReclaimer no longer exists in memory
+   // Return value: N/A
+   // Functions called: N/A
+   ~EpochReclaimer();
+
+   EpochReclaimer(const EpochReclaimer&) = delete;
+   EpochReclaimer& operator=(const EpochReclaimer&) = delete;
+
+private:
+
+   struct Retired {
+      void *object_;
+      void (*destroy_)(void*);
+      uint64_t epoch_;
+   };
+
+   struct ThreadRecord {
+      // Epoch observed by the thread shifted left by one, with the lowest bit set while it is pinned
+      atomic<uint64_t> state_;
+      atomic<bool> inUse_;
+      ThreadRecord *next_;
+      int nesting_;
+      vector<Retired> retired_;
+   };
+
+   struct RecordHolder {
+      ThreadRecord *record_ = nullptr;
+      ~RecordHolder();
+   };
+
+   static const uint64_t ACTIVE = 1;
+   static const size_t COLLECT_INTERVAL = 64;
+
+   atomic<uint64_t> globalEpoch_;
+   atomic<ThreadRecord*> records_;
+
+   // Function purpose: To initialize an EpochReclaimer with no thread records
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: Global epoch is 0
+   // Return value: N/A
+   // Functions called: N/A
+   EpochReclaimer();
+
+   // Function purpose: To return the record of the calling thread, claiming one on first use
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: The record is owned by the calling thread until it exits
+   // Return value: ThreadRecord pointer
+   // Functions called: N/A
+   ThreadRecord* localRecord();
+
+   // Function purpose: To pin the calling thread to the current epoch
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: Nesting count of the calling thread has been incremented
+   // Return value: void
+   // Functions called: localRecord
+   void enter();
+
+   // Function purpose: To unpin the calling thread
+   // Parameters: N/A
+   // Preconditions: The calling thread is pinned
+   // Postconditions: Nesting count of the calling thread has been decremented
+   // Return value: void
+   // Functions called: localRecord
+   void exit();
+
+   // Function purpose: To advance the global epoch if every pinned thread has observed it
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: void
+   // Functions called: N/A
+   void tryAdvance();
+
+   // Function purpose: To destroy the objects of a record that can no longer be referenced
+   // Parameters: A ThreadRecord pointer
+   // Preconditions: The record belongs to the calling thread
+   // Postconditions: Objects retired two or more epochs ago have been destroyed
+   // Return value: void
+   // Functions called: N/A
+   void collect(ThreadRecord *record);
+};
+
+#include "EpochReclaimer.cpp"
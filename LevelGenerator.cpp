@@ -0,0 +1,97 @@
+/*
+LevelGenerator.cpp
+*/
+
+// Function purpose: To initialize a LevelGenerator
+// Parameters: The promotion probability and the seed
+// Preconditions: 0 < probability < 1
+// Postconditions: An initilized LevelGenerator
+// Return value: N/A
+// Functions called: seed
+inline LevelGenerator::LevelGenerator(double probability, uint64_t seedValue) {
+   probability_ = probability;
+   bitsPerLevel_ = 0;
+   for (int k = 1; k < 32; k++) {
+      if (probability == ldexp(1.0, -k)) {
+         bitsPerLevel_ = k;
+         break;
+      }
+   }
+   inverseLogProbability_ = 1.0 / log(probability);
+   seed(seedValue);
+}
+
+// Function purpose: To restart the sequence of heights from a seed
+// Parameters: The seed
+// Preconditions: N/A
+// Postconditions: The generator produces the sequence that belongs to the seed
+// Return value: void
+// Functions called: N/A
+inline void LevelGenerator::seed(uint64_t seedValue) {
+   // splitmix64 spreads similar seeds apart and never leaves the xorshift state at zero
+   uint64_t z = seedValue + 0x9E3779B97F4A7C15ULL;
+   z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+   z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+   z = z ^ (z >> 31);
+   state_ = (z == 0) ? DEFAULT_SEED : z;
+}
+
+// Function purpose: To draw the next random word
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: The state of the generator has advanced
+// Return value: uint64_t
+// Functions called: N/A
+inline uint64_t LevelGenerator::nextWord() {
+   state_ ^= state_ >> 12;
+   state_ ^= state_ << 25;
+   state_ ^= state_ >> 27;
+   return state_ * 0x2545F4914F6CDD1DULL;
+}
+
+// Function purpose: To choose the height of a new node
+// Parameters: An int for the largest height allowed
+// Preconditions: maxHeight > 0
+// Postconditions: N/A
+// Return value: int between 1 and maxHeight
+// Functions called: nextWord
+inline int LevelGenerator::height(int maxHeight) {
+   uint64_t word = nextWord();
+   int levels;
+   if (bitsPerLevel_ > 0) {
+      int zeros = (word == 0) ? 64 : __builtin_ctzll(word);
+      levels = 1 + zeros / bitsPerLevel_;
+   }
+   else {
+      // The top 53 bits give a uniform double in (0, 1]
+      double u = static_cast<double>((word >> 11) + 1) * (1.0 / 9007199254740992.0);
+      double extra = log(u) * inverseLogProbability_;
+      levels = (extra >= maxHeight) ? maxHeight : 1 + static_cast<int>(extra);
+   }
+   return (levels < maxHeight) ? levels : maxHeight;
+}
+
+// Function purpose: To return the number of items that a given number of levels is sized for
+// Parameters: An int for the number of levels
+// Preconditions: levels >= 0
+// Postconditions: N/A
+// Return value: (1 / probability) ^ levels, saturated to the range of uint64_t
+// Functions called: N/A
+inline uint64_t LevelGenerator::capacity(int levels) const {
+   if (bitsPerLevel_ > 0) {
+      int bits = bitsPerLevel_ * levels;
+      return (bits >= 64) ? UINT64_MAX : (1ULL << bits);
+   }
+   double items = pow(1.0 / probability_, levels);
+   return (items >= 18446744073709551615.0) ? UINT64_MAX : static_cast<uint64_t>(items);
+}
+
+// Function purpose: To return the promotion probability
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: double
+// Functions called: N/A
+inline double LevelGenerator::probability() const {
+   return probability_;
+}
@@ -0,0 +1,92 @@
+/*
+LevelGenerator.h
+
+Input & output: LevelGenerator returns the height of a new skip list node. Heights follow a geometric
+distribution in which a node reaches each further level with the promotion probability given to the
+constructor.
+Program use:
+Include LevelGenerator.h. A SkipList owns one LevelGenerator; ConcurrentSkipList keeps one per thread.
+LevelGenerator generator(LevelGenerator::QUARTER, 42); int height = generator.height(maxLevel);
+Assumptions:
+The probability is greater than 0 and less than 1. A LevelGenerator is not synchronized, so an instance
+must only be used by one thread at a time.
+Description:
+One 64-bit word is drawn from a xorshift64* generator per node. When the probability is 1/2^k, the height
+is one plus the number of trailing zero bits of the word divided by k, since each bit is an independent
+fair coin. Any other probability uses the inverse of the geometric distribution, 1 + floor(log(u) / log(p))
+for a uniform u in (0, 1]. Equal seeds always produce equal sequences of heights.
+*/
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+using namespace std;
+
+class LevelGenerator {
+
+public:
+
+   static constexpr double HALF = 0.5;
+   static constexpr double QUARTER = 0.25;
+   static constexpr double INVERSE_E = 0.36787944117144233;
+   static constexpr uint64_t DEFAULT_SEED = 0x9E3779B97F4A7C15ULL;
+
+   // Function purpose: To initialize a LevelGenerator
+   // Parameters: The promotion probability and the seed
+   // Preconditions: 0 < probability < 1
+   // Postconditions: An initilized LevelGenerator
+   // Return value: N/A
+   // Functions called: seed
+   explicit LevelGenerator(double probability = HALF, uint64_t seedValue = DEFAULT_SEED);
+
+   // Function purpose: To restart the sequence of heights from a seed
+   // Parameters: The seed
+   // Preconditions: N/A
+   // Postconditions: The generator produces the sequence that belongs to the seed
+   // Return value: void
+   // Functions called: N/A
+   void seed(uint64_t seedValue);
+
+   // Function purpose: To choose the height of a new node
+   // Parameters: An int for the largest height allowed
+   // Preconditions: maxHeight > 0
+   // Postconditions: N/A
+   // Return value: int between 1 and maxHeight
+   // Functions called: nextWord
+   int height(int maxHeight);
+
+   // Function purpose: To return the number of items that a given number of levels is sized for
+   // Parameters: An int for the number of levels
+   // Preconditions: levels >= 0
+   // Postconditions: N/A
+   // Return value: (1 / probability) ^ levels, saturated to the range of uint64_t
+   // Functions called: N/A
+   uint64_t capacity(int levels) const;
+
+   // Function purpose: To return the promotion probability
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: double
+   // Functions called: N/A
+   double probability() const;
+
+   // Function purpose: To draw the next random word
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: The state of the generator has advanced
+   // Return value: uint64_t
+   // Functions called: N/A
+   uint64_t nextWord();
+
+private:
+   uint64_t state_;
+   double probability_;
+   // k when the probability is 1/2^k, otherwise 0
+   int bitsPerLevel_;
+   double inverseLogProbability_;
+};
+
+#include "LevelGenerator.cpp"
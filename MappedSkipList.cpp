@@ -0,0 +1,396 @@
+/*
+MappedSkipList.cpp
+*/
+
+// Function purpose: To construct an iterator for the MappedSkipList
+// Parameters: A pointer to a MappedSkipList and the index of one of its items
+// Preconditions: index <= size()
+// Postconditions: Iterator located at the item (end() if index == size())
+// Return value: N/A
+// Functions called: N/A
+template<class T, class Compare>
+MappedSkipList<T, Compare>::iterator::iterator(const MappedSkipList *listPtr, uint64_t index)
+   : listPtr_(listPtr), index_(index) {}
+
+// Function purpose: To return the item at the iterator
+// Parameters: N/A
+// Preconditions: The iterator is not at end()
+// Postconditions: N/A
+// Return value: reference to the item, or a string_view of it; operator-> returns a pointer to the item, 
+// or an ArrowProxy holding the string_view
+// Functions called: MappedSkipList::itemAt
+template<class T, class Compare>
+typename MappedSkipList<T, Compare>::reference MappedSkipList<T, Compare>::iterator::operator*() const {
+   return listPtr_->itemAt(index_);
+}
+
+template<class T, class Compare>
+typename MappedSkipList<T, Compare>::iterator::pointer MappedSkipList<T, Compare>::iterator::operator->() const {
+   if constexpr (is_same<T, string>::value) {
+      return ArrowProxy{listPtr_->itemAt(index_)};
+   }
+   else {
+      return &listPtr_->itemAt(index_);
+   }
+}
+
+// Function purpose: To return the address of the string_view held by the proxy
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: const string_view pointer
+// Functions called: N/A
+template<class T, class Compare>
+const typename MappedSkipList<T, Compare>::value_type* MappedSkipList<T, Compare>::iterator::ArrowProxy::operator->() const {
+   return &item_;
+}
+
+// Function purpose: To move the iterator to the next or previous item
+// Parameters: N/A
+// Preconditions: The iterator is not at end() (increment) or begin() (decrement)
+// Postconditions: Moved iterator
+// Return value: iterator
+// Functions called: N/A
+template<class T, class Compare>
+typename MappedSkipList<T, Compare>::iterator& MappedSkipList<T, Compare>::iterator::operator++() {
+   index_++;
+   return (*this);
+}
+
+template<class T, class Compare>
+typename MappedSkipList<T, Compare>::iterator MappedSkipList<T, Compare>::iterator::operator++(int) {
+   iterator temp = *this;
+   ++(*this);
+   return temp;
+}
+
+template<class T, class Compare>
+typename MappedSkipList<T, Compare>::iterator& MappedSkipList<T, Compare>::iterator::operator--() {
+   index_--;
+   return (*this);
+}
+
+template<class T, class Compare>
+typename MappedSkipList<T, Compare>::iterator MappedSkipList<T, Compare>::iterator::operator--(int) {
+   iterator temp = *this;
+   --(*this);
+   return temp;
+}
+
+// Function purpose: To determine whether two iterators are at the same item
+// Parameters: An iterator
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: bool
+// Functions called: N/A
+template<class T, class Compare>
+bool MappedSkipList<T, Compare>::iterator::operator==(const iterator& rhs) const {
+   return listPtr_ == rhs.listPtr_ && index_ == rhs.index_;
+}
+
+template<class T, class Compare>
+bool MappedSkipList<T, Compare>::iterator::operator!=(const iterator& rhs) const {
+   return !(*this == rhs);
+}
+
+// Function purpose: To map a snapshot file
+// Parameters: The path of the file and the comparator
+// Preconditions: The file was written by SkipList<T>::save
+// Postconditions: The file is mapped read-only
+// Return value: N/A; throws system_error if the file cannot be mapped and runtime_error if it is not a
+// snapshot of items of type T
+// Functions called: SkipListSnapshot::checkHeader, mapSections, release
+template<class T, class Compare>
+MappedSkipList<T, Compare>::MappedSkipList(const string& path, const Compare& comp)
+   : base_(nullptr), length_(0), comp_(comp) {
+   int file = ::open(path.c_str(), O_RDONLY);
+   if (file < 0) { throw system_error(errno, generic_category(), "MappedSkipList: cannot open " + path); }
+   struct stat status;
+   if (::fstat(file, &status) != 0) {
+      int error = errno;
+      ::close(file);
+      throw system_error(error, generic_category(), "MappedSkipList: cannot stat " + path);
+   }
+   length_ = static_cast<size_t>(status.st_size);
+   if (length_ < sizeof(SkipListSnapshot::Header)) {
+      ::close(file);
+      throw runtime_error("MappedSkipList: " + path + " is too short to be a snapshot");
+   }
+   void *mapping = ::mmap(nullptr, length_, PROT_READ, MAP_PRIVATE, file, 0);
+   int error = errno;
+   // The mapping keeps the file alive on its own
+   ::close(file);
+   if (mapping == MAP_FAILED) { throw system_error(error, generic_category(), "MappedSkipList: cannot map " + path); }
+   base_ = static_cast<const unsigned char*>(mapping);
+   try {
+      mapSections();
+   }
+   catch (...) {
+      release();
+      throw;
+   }
+}
+
+// Function purpose: To take over the mapping of another MappedSkipList
+// Parameters: A MappedSkipList
+// Preconditions: N/A
+// Postconditions: The parameter no longer holds a mapping
+// Return value: N/A (reference to this object for the assignment)
+// Functions called: release
+template<class T, class Compare>
+MappedSkipList<T, Compare>::MappedSkipList(MappedSkipList&& toMove) noexcept : base_(nullptr), length_(0) {
+   *this = std::move(toMove);
+}
+
+template<class T, class Compare>
+MappedSkipList<T, Compare>& MappedSkipList<T, Compare>::operator=(MappedSkipList&& rhs) noexcept {
+   if (this != &rhs) {
+      release();
+      base_ = rhs.base_;
+      length_ = rhs.length_;
+      count_ = rhs.count_;
+      levels_ = rhs.levels_;
+      items_ = rhs.items_;
+      offsets_ = rhs.offsets_;
+      characters_ = rhs.characters_;
+      characterBytes_ = rhs.characterBytes_;
+      for (uint32_t i = 0; i < SkipListSnapshot::MAX_LEVELS; i++) {
+         links_[i] = rhs.links_[i];
+         linkCounts_[i] = rhs.linkCounts_[i];
+      }
+      comp_ = rhs.comp_;
+      rhs.base_ = nullptr;
+      rhs.length_ = 0;
+   }
+   return (*this);
+}
+
+// Function purpose: To unmap the file
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: The mapping is released
+// Return value: N/A
+// Functions called: release
+template<class T, class Compare>
+MappedSkipList<T, Compare>::~MappedSkipList() {
+   release();
+}
+
+// Function purpose: To locate the sections of the mapped file
+// Parameters: N/A
+// Preconditions: base_ and length_ describe the mapping
+// Postconditions: items_, offsets_, characters_, links_ and linkCounts_ point into the mapping
+// Return value: void; throws runtime_error if a section does not fit in the file
+// Functions called: SkipListSnapshot::checkHeader
+template<class T, class Compare>
+void MappedSkipList<T, Compare>::mapSections() {
+   const SkipListSnapshot::Header *header = reinterpret_cast<const SkipListSnapshot::Header*>(base_);
+   SkipListSnapshot::checkHeader<T>(*header, "MappedSkipList");
+   count_ = header->count;
+   levels_ = header->levels;
+   uint64_t position = sizeof(SkipListSnapshot::Header);
+   if (header->itemBytes > length_ - position) { throw runtime_error("MappedSkipList: truncated item section"); }
+
+   items_ = base_ + position;
+   offsets_ = nullptr;
+   characters_ = nullptr;
+   characterBytes_ = 0;
+   if constexpr (is_same<T, string>::value) {
+      if (count_ >= header->itemBytes / sizeof(uint64_t)) { throw runtime_error("MappedSkipList: corrupt item section"); }
+      offsets_ = reinterpret_cast<const uint64_t*>(items_);
+      characters_ = reinterpret_cast<const char*>(offsets_ + count_ + 1);
+      characterBytes_ = header->itemBytes - (count_ + 1) * sizeof(uint64_t);
+      // The strings are packed from the start of the character section, as SkipList::load reads them
+      if (offsets_[0] != 0 || offsets_[count_] > characterBytes_) {
+         throw runtime_error("MappedSkipList: corrupt string offsets");
+      }
+   }
+   else {
+      if (count_ > header->itemBytes / sizeof(T)) { throw runtime_error("MappedSkipList: corrupt item section"); }
+   }
+   position += header->itemBytes;
+
+   links_[0] = nullptr;
+   linkCounts_[0] = count_;
+   for (uint32_t i = 1; i < levels_; i++) {
+      if (length_ - position < sizeof(uint64_t)) { throw runtime_error("MappedSkipList: truncated level"); }
+      uint64_t length = *reinterpret_cast<const uint64_t*>(base_ + position);
+      position += sizeof(uint64_t);
+      if (length > count_ || length * sizeof(SkipListSnapshot::Link) > length_ - position) {
+         throw runtime_error("MappedSkipList: truncated level");
+      }
+      links_[i] = reinterpret_cast<const SkipListSnapshot::Link*>(base_ + position);
+      linkCounts_[i] = length;
+      position += length * sizeof(SkipListSnapshot::Link);
+   }
+}
+
+// Function purpose: To unmap the file, if one is mapped
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: base_ is nullptr
+// Return value: void
+// Functions called: N/A
+template<class T, class Compare>
+void MappedSkipList<T, Compare>::release() {
+   if (base_ != nullptr) {
+      ::munmap(const_cast<unsigned char*>(base_), length_);
+      base_ = nullptr;
+      length_ = 0;
+   }
+}
+
+// Function purpose: To return the item at an index
+// Parameters: The index
+// Preconditions: index < count_
+// Postconditions: N/A
+// Return value: reference to the item in the mapping, or a string_view of it; throws runtime_error if 
+// the offsets of a string leave the character section
+// Functions called: N/A
+template<class T, class Compare>
+typename MappedSkipList<T, Compare>::reference MappedSkipList<T, Compare>::itemAt(uint64_t index) const {
+   if constexpr (is_same<T, string>::value) {
+      // Only offsets_[count_] was checked when the file was mapped; the others are checked as they are read
+      if (offsets_[index] > offsets_[index + 1] || offsets_[index + 1] > characterBytes_) {
+         throw runtime_error("MappedSkipList: corrupt string offsets");
+      }
+      return string_view(characters_ + offsets_[index], offsets_[index + 1] - offsets_[index]);
+   }
+   else {
+      return reinterpret_cast<const T*>(items_)[index];
+   }
+}
+
+// Function purpose: To find the index of the first item that is not less than a key
+// Parameters: A key
+// Preconditions: Open MappedSkipList
+// Postconditions: N/A
+// Return value: uint64_t, equal to count_ if every item is less than key; throws runtime_error if a link 
+// it follows names an item or position outside the file
+// Functions called: itemAt
+template<class T, class Compare>
+uint64_t MappedSkipList<T, Compare>::lowerBoundIndex(const key_type& key) const {
+   if (levels_ == 1) {
+      uint64_t low = 0;
+      uint64_t high = count_;
+      while (low < high) {
+         uint64_t middle = low + (high - low) / 2;
+         if (comp_(itemAt(middle), key)) { low = middle + 1; }
+         else { high = middle; }
+      }
+      return low;
+   }
+   // next is the position on the current level of the first entry that has not been passed
+   uint64_t next = 0;
+   for (uint32_t i = levels_ - 1; i >= 1; i--) {
+      // The links are read straight from the file, so each one is checked before it is followed
+      const SkipListSnapshot::Link *level = links_[i];
+      while (next < linkCounts_[i]) {
+         if (level[next].item >= count_) { throw runtime_error("MappedSkipList: corrupt link"); }
+         if (!comp_(itemAt(level[next].item), key)) { break; }
+         next++;
+      }
+      if (next > 0 && level[next - 1].down >= linkCounts_[i - 1]) { throw runtime_error("MappedSkipList: corrupt link"); }
+      // Below the last entry passed, the search resumes just after the same item
+      next = (next == 0) ? 0 : level[next - 1].down + 1;
+   }
+   while (next < count_ && comp_(itemAt(next), key)) { next++; }
+   return next;
+}
+
+// Function purpose: To check if the snapshot contains an item
+// Parameters: A key
+// Preconditions: Open MappedSkipList
+// Postconditions: N/A
+// Return value: bool
+// Functions called: lowerBoundIndex
+template<class T, class Compare>
+bool MappedSkipList<T, Compare>::contains(const key_type& key) const {
+   uint64_t index = lowerBoundIndex(key);
+   return index < count_ && !comp_(key, itemAt(index));
+}
+
+// Function purpose: To locate an item
+// Parameters: A key
+// Preconditions: Open MappedSkipList
+// Postconditions: N/A
+// Return value: iterator to the item, or end() if it is not in the snapshot
+// Functions called: lowerBoundIndex
+template<class T, class Compare>
+typename MappedSkipList<T, Compare>::iterator MappedSkipList<T, Compare>::find(const key_type& key) const {
+   uint64_t index = lowerBoundIndex(key);
+   return iterator(this, (index < count_ && !comp_(key, itemAt(index))) ? index : count_);
+}
+
+// Function purpose: To locate the first item that is not less than a key
+// Parameters: A key
+// Preconditions: Open MappedSkipList
+// Postconditions: N/A
+// Return value: iterator, or end() if every item is less than key
+// Functions called: lowerBoundIndex
+template<class T, class Compare>
+typename MappedSkipList<T, Compare>::iterator MappedSkipList<T, Compare>::lower_bound(const key_type& key) const {
+   return iterator(this, lowerBoundIndex(key));
+}
+
+// Function purpose: To check every item and link of the snapshot
+// Parameters: N/A
+// Preconditions: Open MappedSkipList
+// Postconditions: N/A
+// Return value: bool that is true if the items are strictly increasing, string offsets start at 0 and stay 
+// inside the file and every link names an increasing item that is also at its down position on the level below
+// Functions called: itemAt
+template<class T, class Compare>
+bool MappedSkipList<T, Compare>::validate() const {
+   if constexpr (is_same<T, string>::value) {
+      if (offsets_[0] != 0) { return false; }
+      for (uint64_t i = 0; i < count_; i++) {
+         if (offsets_[i] > offsets_[i + 1] || offsets_[i + 1] > characterBytes_) { return false; }
+      }
+   }
+   for (uint64_t i = 1; i < count_; i++) {
+      if (!comp_(itemAt(i - 1), itemAt(i))) { return false; }
+   }
+   for (uint32_t i = 1; i < levels_; i++) {
+      for (uint64_t j = 0; j < linkCounts_[i]; j++) {
+         const SkipListSnapshot::Link &link = links_[i][j];
+         if (link.item >= count_ || (j > 0 && link.item <= links_[i][j - 1].item)) { return false; }
+         if (link.down >= linkCounts_[i - 1]) { return false; }
+         uint64_t below = (i == 1) ? link.down : links_[i - 1][link.down].item;
+         if (below != link.item) { return false; }
+      }
+   }
+   return true;
+}
+
+// Function purpose: To return the number of items or whether there are none
+// Parameters: N/A
+// Preconditions: Open MappedSkipList
+// Postconditions: N/A
+// Return value: size_t / bool
+// Functions called: N/A
+template<class T, class Compare>
+size_t MappedSkipList<T, Compare>::size() const {
+   return static_cast<size_t>(count_);
+}
+
+template<class T, class Compare>
+bool MappedSkipList<T, Compare>::empty() const {
+   return count_ == 0;
+}
+
+// Function purpose: To return iterators to the first item and past the last item
+// Parameters: N/A
+// Preconditions: Open MappedSkipList
+// Postconditions: N/A
+// Return value: iterator
+// Functions called: N/A
+template<class T, class Compare>
+typename MappedSkipList<T, Compare>::iterator MappedSkipList<T, Compare>::begin() const {
+   return iterator(this, 0);
+}
+
+template<class T, class Compare>
+typename MappedSkipList<T, Compare>::iterator MappedSkipList<T, Compare>::end() const {
+   return iterator(this, count_);
+}
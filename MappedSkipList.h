@@ -0,0 +1,252 @@
+/*
+MappedSkipList.h
+
+Input & output: MappedSkipList<T> opens a snapshot written by SkipList<T>::save and answers contains, find,
+lower_bound and ordered iteration straight from the file, which is mapped into memory read-only. Nothing is
+copied or rebuilt when it is opened, so it is ready as soon as the header has been checked.
+Program use:
+Include MappedSkipList.h. MappedSkipList<int> objectName("items.snapshot"); objectName.contains(5);
+Items of a SkipList<string> are read as string_view: MappedSkipList<string> objectName(path); then
+objectName.contains("key") and for (string_view item : objectName) { ... }.
+Assumptions:
+Compare must order the items as the SkipList that saved them did. It is called with T (string_view for
+strings), so the default less<> works for both. The file must not change while it is mapped. Opening
+checks the header and the size of every section; validate() also checks every item and link. A search
+checks each link and string offset it reads and throws runtime_error if one points outside the file, so a
+corrupt file does not crash the process, though it may give wrong answers until validate() rejects it.
+Description:
+The snapshot keeps the items in increasing order in one array, and each level above the lowest as an array
+of Links that name an item and the position of the same item on the level below. A search walks the top
+level from its start, advancing while the next item is less than the key, then follows the down link of
+the last item it passed into the level below. It continues until it reaches the item array, just as a
+SkipList follows its node pointers. A snapshot saved without towers is searched by binary search instead.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "SkipListSnapshot.h"
+
+using namespace std;
+
+template<class T, class Compare = less<>>
+class MappedSkipList {
+
+public:
+
+   using key_type = typename conditional<is_same<T, string>::value, string_view, T>::type;
+   using value_type = key_type;
+   using reference = typename conditional<is_same<T, string>::value, string_view, const T&>::type;
+   using key_compare = Compare;
+
+   class iterator {
+      public:
+      using iterator_category = std::bidirectional_iterator_tag;
+      using difference_type = std::ptrdiff_t;
+      using value_type = typename MappedSkipList::value_type;
+      using reference = typename MappedSkipList::reference;
+
+      // Holds the string_view of a string item, which is built on access, so that operator-> has an object 
+      // to point to
+      struct ArrowProxy {
+         // Function purpose: To return the address of the string_view held by the proxy
+         // Parameters: N/A
+         // Preconditions: N/A
+         // Postconditions: N/A
+         // Return value: const string_view pointer
+         // Functions called: N/A
+         const value_type* operator->() const;
+
+         value_type item_;
+      };
+
+      using pointer = typename conditional<is_same<T, string>::value, ArrowProxy, const value_type*>::type;
+
+      // Function purpose: To construct an iterator for the MappedSkipList
+      // Parameters: A pointer to a MappedSkipList and the index of one of its items
+      // Preconditions: index <= size()
+      // Postconditions: Iterator located at the item (end() if index == size())
+      // Return value: N/A
+      // Functions called: N/A
+      iterator(const MappedSkipList *listPtr = nullptr, uint64_t index = 0);
+
+      // Function purpose: To return the item at the iterator
+      // Parameters: N/A
+      // Preconditions: The iterator is not at end()
+      // Postconditions: N/A
+      // Return value: reference to the item, or a string_view of it; operator-> returns a pointer to the
+      // item, or an ArrowProxy holding the string_view
+      // Functions called: MappedSkipList::itemAt
+      reference operator*() const;
+      pointer operator->() const;
+
+      // Function purpose: To move the iterator to the next or previous item
+      // Parameters: N/A
+      // Preconditions: The iterator is not at end() (increment) or begin() (decrement)
+      // Postconditions: Moved iterator
+      // Return value: iterator
+      // Functions called: N/A
+      iterator& operator++();
+      iterator operator++(int);
+      iterator& operator--();
+      iterator operator--(int);
+
+      // Function purpose: To determine whether two iterators are at the same item
+      // Parameters: An iterator
+      // Preconditions: N/A
+      // Postconditions: N/A
+      // Return value: bool
+      // Functions called: N/A
+      bool operator==(const iterator& rhs) const;
+      bool operator!=(const iterator& rhs) const;
+
+      private:
+      const MappedSkipList *listPtr_;
+      uint64_t index_;
+   };
+
+   using const_iterator = iterator;
+
+   // Function purpose: To map a snapshot file
+   // Parameters: The path of the file and the comparator
+   // Preconditions: The file was written by SkipList<T>::save
+   // Postconditions: The file is mapped read-only
+   // Return value: N/A; throws system_error if the file cannot be mapped and runtime_error if it is not a
+   // snapshot of items of type T
+   // Functions called: SkipListSnapshot::checkHeader, mapSections, release
+   explicit MappedSkipList(const string& path, const Compare& comp = Compare());
+
+   // Function purpose: To take over the mapping of another MappedSkipList
+   // Parameters: A MappedSkipList
+   // Preconditions: N/A
+   // Postconditions: The parameter no longer holds a mapping
+   // Return value: N/A (reference to this object for the assignment)
+   // Functions called: release
+   MappedSkipList(MappedSkipList&& toMove) noexcept;
+   MappedSkipList& operator=(MappedSkipList&& rhs) noexcept;
+
+   MappedSkipList(const MappedSkipList&) = delete;
+   MappedSkipList& operator=(const MappedSkipList&) = delete;
+
+   // Function purpose: To unmap the file
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: The mapping is released
+   // Return value: N/A
+   // Functions called: release
+   ~MappedSkipList();
+
+   // Function purpose: To check if the snapshot contains an item
+   // Parameters: A key
+   // Preconditions: Open MappedSkipList
+   // Postconditions: N/A
+   // Return value: bool
+   // Functions called: lowerBoundIndex
+   bool contains(const key_type& key) const;
+
+   // Function purpose: To locate an item
+   // Parameters: A key
+   // Preconditions: Open MappedSkipList
+   // Postconditions: N/A
+   // Return value: iterator to the item, or end() if it is not in the snapshot
+   // Functions called: lowerBoundIndex
+   iterator find(const key_type& key) const;
+
+   // Function purpose: To locate the first item that is not less than a key
+   // Parameters: A key
+   // Preconditions: Open MappedSkipList
+   // Postconditions: N/A
+   // Return value: iterator, or end() if every item is less than key
+   // Functions called: lowerBoundIndex
+   iterator lower_bound(const key_type& key) const;
+
+   // Function purpose: To check every item and link of the snapshot
+   // Parameters: N/A
+   // Preconditions: Open MappedSkipList
+   // Postconditions: N/A
+   // Return value: bool that is true if the items are strictly increasing, string offsets start at 0 and stay 
+   // inside the file and every link names an increasing item that is also at its down position on the level below
+   // Functions called: itemAt
+   bool validate() const;
+
+   // Function purpose: To return the number of items or whether there are none
+   // Parameters: N/A
+   // Preconditions: Open MappedSkipList
+   // Postconditions: N/A
+   // Return value: size_t / bool
+   // Functions called: N/A
+   size_t size() const;
+   bool empty() const;
+
+   // Function purpose: To return iterators to the first item and past the last item
+   // Parameters: N/A
+   // Preconditions: Open MappedSkipList
+   // Postconditions: N/A
+   // Return value: iterator
+   // Functions called: N/A
+   iterator begin() const;
+   iterator end() const;
+
+private:
+
+   // Function purpose: To return the item at an index
+   // Parameters: The index
+   // Preconditions: index < count_
+   // Postconditions: N/A
+   // Return value: reference to the item in the mapping, or a string_view of it; throws runtime_error if 
+   // the offsets of a string leave the character section
+   // Functions called: N/A
+   reference itemAt(uint64_t index) const;
+
+   // Function purpose: To find the index of the first item that is not less than a key
+   // Parameters: A key
+   // Preconditions: Open MappedSkipList
+   // Postconditions: N/A
+   // Return value: uint64_t, equal to count_ if every item is less than key; throws runtime_error if a link 
+   // it follows names an item or position outside the file
+   // Functions called: itemAt
+   uint64_t lowerBoundIndex(const key_type& key) const;
+
+   // Function purpose: To locate the sections of the mapped file
+   // Parameters: N/A
+   // Preconditions: base_ and length_ describe the mapping
+   // Postconditions: items_, offsets_, characters_, links_ and linkCounts_ point into the mapping
+   // Return value: void; throws runtime_error if a section does not fit in the file
+   // Functions called: SkipListSnapshot::checkHeader
+   void mapSections();
+
+   // Function purpose: To unmap the file, if one is mapped
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: base_ is nullptr
+   // Return value: void
+   // Functions called: N/A
+   void release();
+
+   const unsigned char *base_;
+   size_t length_;
+   uint64_t count_;
+   uint32_t levels_;
+   // Start of the item records, or of the string offsets; characters_ holds the string contents
+   const unsigned char *items_;
+   const uint64_t *offsets_;
+   const char *characters_;
+   uint64_t characterBytes_;
+   const SkipListSnapshot::Link *links_[SkipListSnapshot::MAX_LEVELS];
+   uint64_t linkCounts_[SkipListSnapshot::MAX_LEVELS];
+   Compare comp_;
+};
+
+#include "MappedSkipList.cpp"
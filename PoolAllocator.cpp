@@ -0,0 +1,210 @@
+/*
+PoolAllocator.cpp
+*/
+
+// Function purpose: To initialize an empty NodePool
+// Parameters: The size in bytes of each slab
+// Preconditions: slabSize is large enough to hold several blocks
+// Postconditions: A NodePool that owns no slabs
+// Return value: N/A
+// Functions called: N/A
+inline NodePool::NodePool(size_t slabSize) {
+   slabSize_ = (slabSize + GRANULE - 1) / GRANULE * GRANULE;
+   reserved_ = 0;
+   cursor_ = nullptr;
+   slabEnd_ = nullptr;
+}
+
+// Function purpose: To release every slab owned by the NodePool
+// Parameters: N/A
+// Preconditions: No block handed out by the pool is still in use
+// Postconditions: NodePool no longer exists in memory
+// Return value: N/A
+// Functions called: N/A
+inline NodePool::~NodePool() {
+   for (void *slab : slabs_) { ::operator delete(slab); }
+   for (void *block : large_) { ::operator delete(block); }
+}
+
+// Function purpose: To map a block size to the index of its free list
+// Parameters: The size of the block in bytes
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: size_t, at least 1
+// Functions called: N/A
+inline size_t NodePool::sizeClass(size_t bytes) {
+   // An empty request still takes a granule, so that every block handed out is distinct and can hold a FreeBlock
+   return (bytes == 0) ? 1 : (bytes + GRANULE - 1) / GRANULE;
+}
+
+// Function purpose: To obtain a fresh slab from the global allocator
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: cursor_ points at the beginning of an unused slab
+// Return value: void
+// Functions called: N/A
+inline void NodePool::refill() {
+   slabs_.reserve(slabs_.size() + 1);
+   cursor_ = static_cast<char*>(::operator new(slabSize_));
+   slabEnd_ = cursor_ + slabSize_;
+   slabs_.push_back(cursor_);
+   reserved_ += slabSize_;
+}
+
+// Function purpose: To obtain a block of memory from the pool
+// Parameters: The size of the block in bytes
+// Preconditions: N/A
+// Postconditions: A block suitably aligned for any fundamental type
+// Return value: void pointer
+// Functions called: sizeClass, refill
+inline void* NodePool::allocate(size_t bytes) {
+   size_t index = sizeClass(bytes);
+   if (index < freeLists_.size() && freeLists_[index] != nullptr) {
+      FreeBlock *block = freeLists_[index];
+      freeLists_[index] = block->next_;
+      return block;
+   }
+   size_t blockSize = index * GRANULE;
+   if (blockSize > slabSize_ / 4) {
+      // Blocks this large would waste most of a slab; they are tracked so the pool can still free them
+      large_.reserve(large_.size() + 1);
+      void *block = ::operator new(blockSize);
+      large_.push_back(block);
+      reserved_ += blockSize;
+      return block;
+   }
+   if (cursor_ == nullptr || static_cast<size_t>(slabEnd_ - cursor_) < blockSize) {
+      refill();
+   }
+   void *block = cursor_;
+   cursor_ += blockSize;
+   return block;
+}
+
+// Function purpose: To return a block to the pool so that it can be reused
+// Parameters: The block and the size that was passed to allocate
+// Preconditions: block was returned by allocate on this pool with the same size
+// Postconditions: The block is on the free list of its size class
+// Return value: void
+// Functions called: sizeClass
+inline void NodePool::deallocate(void *block, size_t bytes) {
+   size_t index = sizeClass(bytes);
+   if (index >= freeLists_.size()) {
+      freeLists_.resize(index + 1, nullptr);
+   }
+   FreeBlock *freed = static_cast<FreeBlock*>(block);
+   freed->next_ = freeLists_[index];
+   freeLists_[index] = freed;
+}
+
+// Function purpose: To return the number of bytes the pool has obtained from the global allocator
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: size_t
+// Functions called: N/A
+inline size_t NodePool::reservedBytes() const {
+   return reserved_;
+}
+
+// Function purpose: To return the size of the slabs the pool obtains
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: size_t
+// Functions called: N/A
+inline size_t NodePool::slabSize() const {
+   return slabSize_;
+}
+
+// Function purpose: To initialize a PoolAllocator with a new NodePool
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: A PoolAllocator that is the only user of its pool
+// Return value: N/A
+// Functions called: N/A
+template<class T>
+PoolAllocator<T>::PoolAllocator() : pool_(make_shared<NodePool>()) {}
+
+// Function purpose: To initialize a PoolAllocator that draws from an existing NodePool
+// Parameters: A shared pointer to a NodePool
+// Preconditions: pool is not a nullptr
+// Postconditions: A PoolAllocator sharing the pool
+// Return value: N/A
+// Functions called: N/A
+template<class T>
+PoolAllocator<T>::PoolAllocator(shared_ptr<NodePool> pool) : pool_(pool) {}
+
+// Function purpose: To rebind a PoolAllocator of another type to the same NodePool
+// Parameters: A PoolAllocator
+// Preconditions: N/A
+// Postconditions: A PoolAllocator sharing the pool of the parameter
+// Return value: N/A
+// Functions called: N/A
+template<class T>
+template<class U>
+PoolAllocator<T>::PoolAllocator(const PoolAllocator<U>& other) : pool_(other.pool_) {}
+
+// Function purpose: To allocate storage for n objects of type T
+// Parameters: The number of objects
+// Preconditions: N/A
+// Postconditions: Uninitialized storage for n objects
+// Return value: T pointer
+// Functions called: NodePool::allocate
+template<class T>
+T* PoolAllocator<T>::allocate(size_t n) {
+   static_assert(alignof(T) <= alignof(max_align_t), "PoolAllocator does not support over-aligned types");
+   return static_cast<T*>(pool_->allocate(n * sizeof(T)));
+}
+
+// Function purpose: To release storage obtained from allocate
+// Parameters: The storage and the number of objects it was allocated for
+// Preconditions: p was returned by allocate(n) on an allocator sharing the same pool
+// Postconditions: The storage may be handed out again by the pool
+// Return value: void
+// Functions called: NodePool::deallocate
+template<class T>
+void PoolAllocator<T>::deallocate(T *p, size_t n) {
+   pool_->deallocate(p, n * sizeof(T));
+}
+
+// Function purpose: To choose the allocator of a copy of a container
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: PoolAllocator with a new NodePool of the same slab size, so that the copy does not share
+// an unsynchronized pool with the original
+// Functions called: NodePool::slabSize
+template<class T>
+PoolAllocator<T> PoolAllocator<T>::select_on_container_copy_construction() const {
+   return PoolAllocator<T>(make_shared<NodePool>(pool_->slabSize()));
+}
+
+// Function purpose: To return the NodePool used by the allocator
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: shared pointer to NodePool
+// Functions called: N/A
+template<class T>
+shared_ptr<NodePool> PoolAllocator<T>::pool() const {
+   return pool_;
+}
+
+// Function purpose: To determine whether two allocators can free each other's storage
+// Parameters: PoolAllocator as right hand argument
+// Preconditions: N/A
+// Postconditions: bool reflecting whether both allocators share a pool
+// Return value: bool
+// Functions called: N/A
+template<class T>
+template<class U>
+bool PoolAllocator<T>::operator==(const PoolAllocator<U>& rhs) const {
+   return pool_ == rhs.pool_;
+}
+
+template<class T>
+template<class U>
+bool PoolAllocator<T>::operator!=(const PoolAllocator<U>& rhs) const {
+   return pool_ != rhs.pool_;
+}
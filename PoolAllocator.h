@@ -0,0 +1,206 @@
+/*
+PoolAllocator.h
+
+Input & output: PoolAllocator<T> is a standard allocator that may be passed as the Allocator argument of
+SkipList (or any allocator-aware container). allocate and deallocate are served from a NodePool.
+Program use:
+Include PoolAllocator.h and name it as the allocator of the container:
+SkipList<int, less<int>, PoolAllocator<int>> objectName;
+Allocators that are copied or rebound from one another share the same NodePool, so every node of a
+container comes from one pool. A default-constructed PoolAllocator creates a new pool. A copy of a container
+gets a new pool of its own (select_on_container_copy_construction), and a container that is copy-assigned
+keeps its pool, so two containers only share a pool if they are given allocators that share one.
+Assumptions:
+A NodePool is not synchronized. A pool must only be used by one thread at a time, so containers sharing a
+pool must not be used by different threads at once.
+Description:
+The NodePool carves blocks out of large slabs obtained from the global allocator. Freed blocks are kept
+on a free list for their size class and handed out again by the next allocation of that size, so a
+container that keeps erasing and inserting stops calling the global allocator once it has reached its
+peak size. Slabs are only returned to the global allocator when the last allocator sharing the pool
+is destroyed.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+using namespace std;
+
+class NodePool {
+public:
+
+   // Function purpose: To initialize an empty NodePool
+   // Parameters: The size in bytes of each slab
+   // Preconditions: slabSize is large enough to hold several blocks
+   // Postconditions: A NodePool that owns no slabs
+   // Return value: N/A
+   // Functions called: N/A
+   explicit NodePool(size_t slabSize = 64 * 1024);
+
+   // Function purpose: To release every slab owned by the NodePool
+   // Parameters: N/A
+   // Preconditions: No block handed out by the pool is still in use
+   // Postconditions: NodePool no longer exists in memory
+   // Return value: N/A
+   // Functions called: N/A
+   ~NodePool();
+
+   NodePool(const NodePool&) = delete;
+   NodePool& operator=(const NodePool&) = delete;
+
+   // Function purpose: To obtain a block of memory from the pool
+   // Parameters: The size of the block in bytes
+   // Preconditions: N/A
+   // Postconditions: A block suitably aligned for any fundamental type
+   // Return value: void pointer
+   // Functions called: sizeClass, refill
+   void* allocate(size_t bytes);
+
+   // Function purpose: To return a block to the pool so that it can be reused
+   // Parameters: The block and the size that was passed to allocate
+   // Preconditions: block was returned by allocate on this pool with the same size
+   // Postconditions: The block is on the free list of its size class
+   // Return value: void
+   // Functions called: sizeClass
+   void deallocate(void *block, size_t bytes);
+
+   // Function purpose: To return the number of bytes the pool has obtained from the global allocator
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: size_t
+   // Functions called: N/A
+   size_t reservedBytes() const;
+
+   // Function purpose: To return the size of the slabs the pool obtains
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: size_t
+   // Functions called: N/A
+   size_t slabSize() const;
+
+private:
+
+   struct FreeBlock {
+      FreeBlock *next_;
+   };
+
+   static const size_t GRANULE = alignof(max_align_t);
+
+   size_t slabSize_;
+   size_t reserved_;
+   char *cursor_;
+   char *slabEnd_;
+   vector<void*> slabs_;
+   vector<void*> large_;
+   vector<FreeBlock*> freeLists_;
+
+   // Function purpose: To map a block size to the index of its free list
+   // Parameters: The size of the block in bytes
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: size_t, at least 1
+   // Functions called: N/A
+   static size_t sizeClass(size_t bytes);
+
+   // Function purpose: To obtain a fresh slab from the global allocator
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: cursor_ points at the beginning of an unused slab
+   // Return value: void
+   // Functions called: N/A
+   void refill();
+};
+
+template<class T>
+class PoolAllocator {
+
+   template<class U>
+   friend class PoolAllocator;
+
+public:
+   using value_type = T;
+   using propagate_on_container_copy_assignment = false_type;
+   using propagate_on_container_move_assignment = true_type;
+   using propagate_on_container_swap = true_type;
+
+   // Function purpose: To initialize a PoolAllocator with a new NodePool
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: A PoolAllocator that is the only user of its pool
+   // Return value: N/A
+   // Functions called: N/A
+   PoolAllocator();
+
+   // Function purpose: To initialize a PoolAllocator that draws from an existing NodePool
+   // Parameters: A shared pointer to a NodePool
+   // Preconditions: pool is not a nullptr
+   // Postconditions: A PoolAllocator sharing the pool
+   // Return value: N/A
+   // Functions called: N/A
+   explicit PoolAllocator(shared_ptr<NodePool> pool);
+
+   // Function purpose: To rebind a PoolAllocator of another type to the same NodePool
+   // Parameters: A PoolAllocator
+   // Preconditions: N/A
+   // Postconditions: A PoolAllocator sharing the pool of the parameter
+   // Return value: N/A
+   // Functions called: N/A
+   template<class U>
+   PoolAllocator(const PoolAllocator<U>& other);
+
+   // Function purpose: To allocate storage for n objects of type T
+   // Parameters: The number of objects
+   // Preconditions: N/A
+   // Postconditions: Uninitialized storage for n objects
+   // Return value: T pointer
+   // Functions called: NodePool::allocate
+   T* allocate(size_t n);
+
+   // Function purpose: To release storage obtained from allocate
+   // Parameters: The storage and the number of objects it was allocated for
+   // Preconditions: p was returned by allocate(n) on an allocator sharing the same pool
+   // Postconditions: The storage may be handed out again by the pool
+   // Return value: void
+   // Functions called: NodePool::deallocate
+   void deallocate(T *p, size_t n);
+
+   // Function purpose: To choose the allocator of a copy of a container
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: PoolAllocator with a new NodePool of the same slab size, so that the copy does not share
+   // an unsynchronized pool with the original
+   // Functions called: NodePool::slabSize
+   PoolAllocator select_on_container_copy_construction() const;
+
+   // Function purpose: To return the NodePool used by the allocator
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: shared pointer to NodePool
+   // Functions called: N/A
+   shared_ptr<NodePool> pool() const;
+
+   // Function purpose: To determine whether two allocators can free each other's storage
+   // Parameters: PoolAllocator as right hand argument
+   // Preconditions: N/A
+   // Postconditions: bool reflecting whether both allocators share a pool
+   // Return value: bool
+   // Functions called: N/A
+   template<class U>
+   bool operator==(const PoolAllocator<U>& rhs) const;
+
+   template<class U>
+   bool operator!=(const PoolAllocator<U>& rhs) const;
+
+private:
+   shared_ptr<NodePool> pool_;
+};
+
+#include "PoolAllocator.cpp"
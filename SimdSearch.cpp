@@ -0,0 +1,135 @@
+/*
+SimdSearch.cpp
+*/
+
+// Function purpose: To tell whether lowerBound can search items of a type ordered by a comparator
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: bool that is true for 32-bit and 64-bit integers, float and double ordered by less, as
+// far as the instruction set enabled at compile time can compare them
+// Functions called: isLess, lanes
+template<class T, class Compare>
+constexpr bool SimdSearch::supports() {
+   return isLess<T, Compare>() && is_arithmetic<T>::value && !is_same<T, bool>::value && lanes<T>() > 0;
+}
+
+// Function purpose: To find the first item of a sorted array that is not less than a key
+// Parameters: The items, the number of items and the key
+// Preconditions: supports<T, Compare>() for the Compare the items are sorted by; count >= 0
+// Postconditions: N/A
+// Return value: int between 0 and count
+// Functions called: lanes, lessMask
+template<class T>
+int SimdSearch::lowerBound(const T *items, int count, T key) {
+   constexpr int window = lanes<T>();
+   static_assert(window > 0, "SimdSearch::lowerBound needs a type that supports() accepts");
+   if (count < window) {
+      int pos = 0;
+      while (pos < count && items[pos] < key) {
+         pos++;
+      }
+      return pos;
+   }
+   // Every item left of base is less than key and every item right of base + n is not
+   const T *base = items;
+   int n = count;
+   while (n > window) {
+      int half = n / 2;
+      base = (base[half] < key) ? base + half : base;
+      n -= half;
+   }
+   if (base + window > items + count) {
+      base = items + count - window;
+   }
+   return static_cast<int>(base - items) + __builtin_ctz(~lessMask(base, key));
+}
+
+// Function purpose: To tell whether a comparator is less for a type
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: bool
+// Functions called: N/A
+template<class T, class Compare>
+constexpr bool SimdSearch::isLess() {
+   return is_same<Compare, less<T>>::value || is_same<Compare, less<>>::value;
+}
+
+// Function purpose: To return the number of items of a type compared by one instruction
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: int, 0 if the instruction set enabled at compile time cannot compare the type
+// Functions called: N/A
+template<class T>
+constexpr int SimdSearch::lanes() {
+   if (!is_arithmetic<T>::value || (sizeof(T) != 4 && sizeof(T) != 8)) {
+      return 0;
+   }
+#if defined(__AVX2__)
+   return 32 / sizeof(T);
+#elif defined(__SSE4_2__)
+   return 16 / sizeof(T);
+#elif defined(__SSE2__)
+   // SSE2 has no 64-bit integer comparison
+   return (is_integral<T>::value && sizeof(T) == 8) ? 0 : 16 / sizeof(T);
+#else
+   return 0;
+#endif
+}
+
+// Function purpose: To compare a window of items with a key
+// Parameters: The first item of the window and the key
+// Preconditions: lanes<T>() > 0 and lanes<T>() items start at items
+// Postconditions: N/A
+// Return value: int whose bit i is set if items[i] < key
+// Functions called: N/A
+template<class T>
+int SimdSearch::lessMask(const T *items, T key) {
+#if defined(__AVX2__)
+   if constexpr (is_floating_point<T>::value && sizeof(T) == 4) {
+      return _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(items), _mm256_set1_ps(key), _CMP_LT_OQ));
+   }
+   else if constexpr (is_floating_point<T>::value) {
+      return _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(items), _mm256_set1_pd(key), _CMP_LT_OQ));
+   }
+   else if constexpr (sizeof(T) == 4) {
+      const __m256i flip = _mm256_set1_epi32(is_signed<T>::value ? 0 : INT32_MIN);
+      __m256i keys = _mm256_xor_si256(_mm256_set1_epi32(static_cast<int32_t>(key)), flip);
+      __m256i vals = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(items)), flip);
+      return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(keys, vals)));
+   }
+   else {
+      const __m256i flip = _mm256_set1_epi64x(is_signed<T>::value ? 0 : INT64_MIN);
+      __m256i keys = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<int64_t>(key)), flip);
+      __m256i vals = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(items)), flip);
+      return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(keys, vals)));
+   }
+#elif defined(__SSE2__)
+   if constexpr (is_floating_point<T>::value && sizeof(T) == 4) {
+      return _mm_movemask_ps(_mm_cmplt_ps(_mm_loadu_ps(items), _mm_set1_ps(key)));
+   }
+   else if constexpr (is_floating_point<T>::value) {
+      return _mm_movemask_pd(_mm_cmplt_pd(_mm_loadu_pd(items), _mm_set1_pd(key)));
+   }
+   else if constexpr (sizeof(T) == 4) {
+      const __m128i flip = _mm_set1_epi32(is_signed<T>::value ? 0 : INT32_MIN);
+      __m128i keys = _mm_xor_si128(_mm_set1_epi32(static_cast<int32_t>(key)), flip);
+      __m128i vals = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(items)), flip);
+      return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(keys, vals)));
+   }
+   else {
+#if defined(__SSE4_2__)
+      const __m128i flip = _mm_set1_epi64x(is_signed<T>::value ? 0 : INT64_MIN);
+      __m128i keys = _mm_xor_si128(_mm_set1_epi64x(static_cast<int64_t>(key)), flip);
+      __m128i vals = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(items)), flip);
+      return _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(keys, vals)));
+#else
+      return (items[0] < key) | ((items[1] < key) << 1);
+#endif
+   }
+#else
+   return items[0] < key;
+#endif
+}
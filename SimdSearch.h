@@ -0,0 +1,88 @@
+/*
+SimdSearch.h
+
+Input & output: SimdSearch finds the first item of a short sorted array that is not less than a key by
+comparing several items per instruction. It serves the in-node search of UnrolledSkipList for arithmetic
+keys ordered by less.
+Program use:
+Included by UnrolledSkipList.h; it is not used directly.
+if (SimdSearch::supports<T, Compare>()) { int pos = SimdSearch::lowerBound(items, count, key); }
+Build with -mavx2 (or -march=native) to compare eight 32-bit or four 64-bit items at a time; otherwise
+x86-64 uses SSE2, and SSE4.2 when it is enabled, for half as many. Other targets use the scalar search.
+Assumptions:
+The items are sorted by less. Floating-point items are not NaN, as less is no ordering for NaN.
+Description:
+A vector holds a window of lanes() items: eight 32-bit or four 64-bit items with AVX2, half as many with
+SSE. The search first halves the range without branches, as the scalar search does, until it is no wider
+than a window, then compares the whole window with the key broadcast to every lane. The items are sorted,
+so the lanes less than the key form a prefix of the comparison mask, and the lowest zero bit of the mask is
+the position returned. Near the end of the array the window is moved left so that it stays inside the
+array; the items it gains are already known to be less than the key. Unsigned keys are compared as signed
+after flipping their sign bits, since SSE and AVX2 only compare signed integers.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+class SimdSearch {
+
+public:
+
+   // Function purpose: To tell whether lowerBound can search items of a type ordered by a comparator
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: bool that is true for 32-bit and 64-bit integers, float and double ordered by less, as
+   // far as the instruction set enabled at compile time can compare them
+   // Functions called: N/A
+   template<class T, class Compare>
+   static constexpr bool supports();
+
+   // Function purpose: To find the first item of a sorted array that is not less than a key
+   // Parameters: The items, the number of items and the key
+   // Preconditions: supports<T, Compare>() for the Compare the items are sorted by; count >= 0
+   // Postconditions: N/A
+   // Return value: int between 0 and count
+   // Functions called: N/A
+   template<class T>
+   static int lowerBound(const T *items, int count, T key);
+
+private:
+
+   // Function purpose: To tell whether a comparator is less for a type
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: bool
+   // Functions called: N/A
+   template<class T, class Compare>
+   static constexpr bool isLess();
+
+   // Function purpose: To return the number of items of a type compared by one instruction
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: int, 0 if the instruction set enabled at compile time cannot compare the type
+   // Functions called: N/A
+   template<class T>
+   static constexpr int lanes();
+
+   // Function purpose: To compare a window of items with a key
+   // Parameters: The first item of the window and the key
+   // Preconditions: lanes<T>() > 0 and lanes<T>() items start at items
+   // Postconditions: N/A
+   // Return value: int whose bit i is set if items[i] < key
+   // Functions called: N/A
+   template<class T>
+   static int lessMask(const T *items, T key);
+};
+
+#include "SimdSearch.cpp"
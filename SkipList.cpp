@@ -4,29 +4,72 @@ Created by Martin Rudzis
 5/5/2021
 */
 
-// Function purpose: Print a SkipList using cout <<
-// Parameters: N/A
-// Preconditions: An initialized SkipList
-// Postconditions: Each level of the SkipList is printed to the console
-// Return value: ostream
+// Function purpose: Initilize a SkipListNode
+// Parameters: The number of levels the node occupies and the arguments of the constructor of T
+// Preconditions: height is > 0 and storage for height forward pointers follows the node
+// Postconditions: An initilized SkipListNode with all forward pointers set to nullptr
+// Return value: N/A
 // Functions called: N/A
-template<class T>
-SkipList<T>::SkipListNode::SkipListNode(T data) {
-   this->data_ = data;
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class... Args>
+SkipList<T, Compare, Allocator, Indexed>::SkipListNode::SkipListNode(int height, Args&&... args) 
+   : data_(std::forward<Args>(args)...) {
    this->prev_ = nullptr;
-   this->next_ = nullptr;
-   this->upLevel_ = nullptr;
-   this->downLevel_ = nullptr;
+   this->height_ = height;
+   for (int i = 0; i < height; i++) {
+      next(i) = nullptr;
+   }
+}
+
+// Function purpose: To access the forward pointer of the node at a given level
+// Parameters: An int for the level
+// Preconditions: 0 <= level < height_
+// Postconditions: N/A
+// Return value: reference to the forward pointer
+// Functions called: N/A
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::SkipListNode*& SkipList<T, Compare, Allocator, Indexed>::SkipListNode::next(int level) {
+   return reinterpret_cast<SkipListNode**>(this + 1)[level];
+}
+
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::SkipListNode* SkipList<T, Compare, Allocator, Indexed>::SkipListNode::next(int level) const {
+   return reinterpret_cast<SkipListNode* const*>(this + 1)[level];
+}
+
+// Function purpose: To access the width of the forward link of the node at a given level
+// Parameters: An int for the level
+// Preconditions: Indexed is true and 0 <= level < height_
+// Postconditions: N/A
+// Return value: reference to the number of lowest-level steps the link spans
+// Functions called: N/A
+template<class T, class Compare, class Allocator, bool Indexed>
+int& SkipList<T, Compare, Allocator, Indexed>::SkipListNode::width(int level) {
+   return reinterpret_cast<int*>(reinterpret_cast<SkipListNode**>(this + 1) + height_)[level];
+}
+
+// Function purpose: To initialize a SearchPath
+// Parameters: An int for the number of levels in use
+// Preconditions: 0 < levels <= MAX_LEVEL
+// Postconditions: The first levels predecessors are the heads
+// Return value: N/A
+// Functions called: N/A
+template<class T, class Compare, class Allocator, bool Indexed>
+SkipList<T, Compare, Allocator, Indexed>::SearchPath::SearchPath(int levels) {
+   for (int i = 0; i < levels; i++) {
+      nodes_[i] = nullptr;
+      if (Indexed) { ranks_[i] = 0; }
+   }
 }
 
 // Function purpose: To construct an iterator for the SkipList
 // Parameters: A pointer to a SkipList and a pointer to one of its SkipListNodes
 // Preconditions: Initialized SkipList
-// Postconditions: Iterator located at SkipListNode in SkipList
+// Postconditions: Iterator located at SkipListNode in SkipList (end() if nullptr)
 // Return value: N/A
 // Functions called: N/A
-template<class T>
-SkipList<T>::iterator::iterator(SkipList<T> *skpPtr, SkipListNode *nodePtr) {
+template<class T, class Compare, class Allocator, bool Indexed>
+SkipList<T, Compare, Allocator, Indexed>::iterator::iterator(const SkipList<T, Compare, Allocator, Indexed> *skpPtr, SkipListNode *nodePtr) {
    this->skpPtr_ = skpPtr;
    this->nodePtr_ = nodePtr;
 }
@@ -37,57 +80,75 @@ SkipList<T>::iterator::iterator(SkipList<T> *skpPtr, SkipListNode *nodePtr) {
 // Postconditions: Item stored at location in SkipList
 // Return value: const referenst to type <T>
 // Functions called: N/A
-template<class T>
-const T& SkipList<T>::iterator::operator*() const {
+template<class T, class Compare, class Allocator, bool Indexed>
+const T& SkipList<T, Compare, Allocator, Indexed>::iterator::operator*() const {
    return nodePtr_->data_;
 }
 
-// Function purpose: To increment the iterator to the item in nodePtr->next_ (prefix incrementation)
+template<class T, class Compare, class Allocator, bool Indexed>
+const T* SkipList<T, Compare, Allocator, Indexed>::iterator::operator->() const {
+   return &nodePtr_->data_;
+}
+
+// Function purpose: To increment the iterator to the item in nodePtr->next(0) (prefix incrementation)
 // Parameters: N/A
 // Preconditions: Initialized iterator
 // Postconditions: Incremented iterator 
 // Return value: iterator
 // Functions called: N/A
-template<class T>
-typename SkipList<T>::iterator& SkipList<T>::iterator::operator++() {
-   nodePtr_ = nodePtr_->next_;
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::iterator& SkipList<T, Compare, Allocator, Indexed>::iterator::operator++() {
+   nodePtr_ = nodePtr_->next(0);
    return (*this);
 }
 
-// Function purpose: To return the current iterator, then increment it to the item in nodePtr->next_ (postfix incrementation)
+// Function purpose: To return the current iterator, then increment it to the item in nodePtr->next(0) (postfix incrementation)
 // Parameters: N/A
 // Preconditions: Initialized iterator
 // Postconditions: Iterator located at the current position of iterator before it was incremented
 // Return value: iterator
 // Functions called: N/A
-template<class T>
-typename SkipList<T>::iterator SkipList<T>::iterator::operator++(int) {
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::iterator SkipList<T, Compare, Allocator, Indexed>::iterator::operator++(int) {
    iterator temp = *this;
    ++(*this);
    return temp;
 }
 
-// Function purpose: To set current iterator to the same location as another iterator
+// Function purpose: To decrement the iterator to the item in nodePtr->prev_, or from end() to the last 
+// item (prefix decrementation)
 // Parameters: N/A
-// Preconditions: An initialized iterator
-// Postconditions: Iterator located at the same position as its right-hand argument 
-// Return value: iterator reference
-// Functions called: N/A      
-template<class T>
-typename SkipList<T>::iterator& SkipList<T>::iterator::operator=(const iterator &rhs) {
-   this->skpPtr_ = rhs.skpPtr_;
-   this->nodePtr_ = rhs.nodePtr_;
+// Preconditions: Initialized iterator that is not at begin()
+// Postconditions: Decremented iterator 
+// Return value: iterator
+// Functions called: N/A
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::iterator& SkipList<T, Compare, Allocator, Indexed>::iterator::operator--() {
+   nodePtr_ = (nodePtr_ == nullptr) ? skpPtr_->tails_[0] : nodePtr_->prev_;
    return (*this);
 }
 
+// Function purpose: To return the current iterator, then decrement it (postfix decrementation)
+// Parameters: N/A
+// Preconditions: Initialized iterator that is not at begin()
+// Postconditions: Iterator located at the current position of iterator before it was decremented
+// Return value: iterator
+// Functions called: N/A
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::iterator SkipList<T, Compare, Allocator, Indexed>::iterator::operator--(int) {
+   iterator temp = *this;
+   --(*this);
+   return temp;
+}
+
 // Function purpose: To determine whether two iterators are at the same location (equal)
 // Parameters: N/A
 // Preconditions: An initialized iterator
 // Postconditions: bool reflecting whether two iterators are at the same location
 // Return value: bool
 // Functions called: N/A
-template<class T>
-bool SkipList<T>::iterator::operator==(const iterator& rhs) const {
+template<class T, class Compare, class Allocator, bool Indexed>
+bool SkipList<T, Compare, Allocator, Indexed>::iterator::operator==(const iterator& rhs) const {
    return (skpPtr_ == rhs.skpPtr_) && (nodePtr_ == rhs.nodePtr_);
 }
 
@@ -96,88 +157,165 @@ bool SkipList<T>::iterator::operator==(const iterator& rhs) const {
 // Preconditions: An initialized iterator
 // Postconditions: bool reflecting whether two iterators are not at the same location
 // Return value: bool
+// Functions called: operator==
+template<class T, class Compare, class Allocator, bool Indexed>
+bool SkipList<T, Compare, Allocator, Indexed>::iterator::operator!=(const iterator& rhs) const {
+   return !(*this == rhs);
+}
+
+// Function purpose: To construct a view over the items between two iterators
+// Parameters: Iterators to the first item and past the last item of the view
+// Preconditions: last is reachable from first
+// Postconditions: An initialized range_view
+// Return value: N/A
 // Functions called: N/A
-template<class T>
-bool SkipList<T>::iterator::operator!=(const iterator& rhs) const {
-   return (skpPtr_ == rhs.skpPtr_) && !(nodePtr_ == rhs.nodePtr_);
+template<class T, class Compare, class Allocator, bool Indexed>
+SkipList<T, Compare, Allocator, Indexed>::range_view::range_view(iterator first, iterator last) : first_(first), last_(last) {}
+
+// Function purpose: To return the iterators that bound the view, for use in range-based for loops
+// Parameters: N/A
+// Preconditions: Initialized range_view
+// Postconditions: N/A
+// Return value: iterator
+// Functions called: N/A
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::iterator SkipList<T, Compare, Allocator, Indexed>::range_view::begin() const {
+   return first_;
+}
+
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::iterator SkipList<T, Compare, Allocator, Indexed>::range_view::end() const {
+   return last_;
 }
 
-// Function purpose: Print a SkipList using cout <<
+// Function purpose: To indicate whether the view holds no items
+// Parameters: N/A
+// Preconditions: Initialized range_view
+// Postconditions: N/A
+// Return value: bool
+// Functions called: N/A
+template<class T, class Compare, class Allocator, bool Indexed>
+bool SkipList<T, Compare, Allocator, Indexed>::range_view::empty() const {
+   return first_ == last_;
+}
+
+// Function purpose: Print a SkipList using <<
 // Parameters: N/A
 // Preconditions: An initialized SkipList
-// Postconditions: Each level of the SkipList is printed to the console
+// Postconditions: Each level of the SkipList is written to out
 // Return value: ostream
 // Functions called: N/A
-template<class TypeName>
-ostream &operator<<(ostream &out, const SkipList<TypeName> &skp) {
+template<class TypeName, class Comp, class Alloc, bool Idx>
+ostream &operator<<(ostream &out, const SkipList<TypeName, Comp, Alloc, Idx> &skp) {
    for (int i = skp.maxLevel_ - 1; i >= 0; i--) {
-      cout << "Level: " << i << " -- ";
-      typename SkipList<TypeName>::SkipListNode *curr = skp.heads_[i];
-      if (curr == nullptr) {cout << "empty";}
+      out << "Level: " << i << " -- ";
+      typename SkipList<TypeName, Comp, Alloc, Idx>::SkipListNode *curr = skp.heads_[i];
+      if (curr == nullptr) {out << "empty";}
       while (curr != nullptr) {
-         if (curr->next_ == nullptr) { cerr << curr->data_; } 
-         else { cerr << curr->data_ << ", "; }
-         curr = curr->next_;
+         if (curr->next(i) == nullptr) { out << curr->data_; } 
+         else { out << curr->data_ << ", "; }
+         curr = curr->next(i);
       }
-      cout << endl;
+      out << endl;
    }
    return out;
 }
 
 // Function purpose: To initialize a SkipList object
-// Parameters: A data type <T>
+// Parameters: The number of levels and the allocator used for nodes
 // Preconditions: skiplist.h has been included in the driver file
 // Postconditions: An initilized SkipList 
 // Return value: N/A
 // Functions called: N/A
-template<class T>
-SkipList<T>::SkipList(int maxLevel) {
-   try 
-   {
-      if (maxLevel <= 0) {
-         cout << "Error: Invalid number of levels" << endl;
-         exit(1);
-      } 
-      else {
-         maxLevel_ = maxLevel;
-         size_ = 0;
-         heads_ = new SkipListNode*[maxLevel_];
-         tails_ = new SkipListNode*[maxLevel_];
-
-         for (int i = 0; i < maxLevel_; i++) {
-            heads_[i] = nullptr;
-            tails_[i] = nullptr;
-         }
-      }
-   }
-   catch(exception &e) 
-   {
-      cout << "Error: Invalid number of levels" << endl;
-      exit(1);
-   }
-}
+template<class T, class Compare, class Allocator, bool Indexed>
+SkipList<T, Compare, Allocator, Indexed>::SkipList(int maxLevel, const Allocator& alloc) : SkipList(maxLevel, Compare(), alloc) {}
 
-// Function purpose: To initialilize a SkipList using initializer_list
-// Parameters: an initilization list
-// Preconditions: N/A
-// Postconditions: initilized Skiplist
-// Return value: N/A
+// Function purpose: To initialize a SkipList object that orders its items with a given comparator
+// Parameters: The number of levels, the comparator and the allocator used for nodes
+// Preconditions: comp is a strict weak ordering
+// Postconditions: An initilized SkipList 
+// Return value: N/A; throws invalid_argument if maxLevel <= 0
 // Functions called: N/A
-template<class T> 
-SkipList<T>::SkipList(initializer_list<T> vals) {
-   maxLevel_ = 1;
+template<class T, class Compare, class Allocator, bool Indexed>
+SkipList<T, Compare, Allocator, Indexed>::SkipList(int maxLevel, const Compare& comp, const Allocator& alloc) 
+   : nodeAlloc_(alloc), comp_(comp) {
+   if (maxLevel <= 0) {
+      throw invalid_argument("SkipList: the number of levels must be greater than 0");
+   }
+   maxLevel_ = (maxLevel < MAX_LEVEL) ? maxLevel : MAX_LEVEL;
    size_ = 0;
    heads_ = new SkipListNode*[maxLevel_];
    tails_ = new SkipListNode*[maxLevel_];
+   headWidths_ = Indexed ? new int[maxLevel_] : nullptr;
+
    for (int i = 0; i < maxLevel_; i++) {
       heads_[i] = nullptr;
       tails_[i] = nullptr;
+      if (Indexed) { headWidths_[i] = 1; }
    }
-   if (vals.size() > 0) {
-      for (T i : vals) {
-         insert(i);
-      }
-   } 
+}
+
+// Function purpose: To initialize a SkipList object that draws node heights from a given generator
+// Parameters: The number of levels, the LevelGenerator and the allocator used for nodes
+// Preconditions: skiplist.h has been included in the driver file
+// Postconditions: An initilized SkipList 
+// Return value: N/A
+// Functions called: N/A
+template<class T, class Compare, class Allocator, bool Indexed>
+SkipList<T, Compare, Allocator, Indexed>::SkipList(int maxLevel, const LevelGenerator& generator, const Allocator& alloc) 
+   : SkipList(maxLevel, alloc) {
+   levelGenerator_ = generator;
+}
+
+// Function purpose: To initialilize a SkipList using initializer_list
+// Parameters: an initilization list and the allocator used for nodes
+// Preconditions: N/A
+// Postconditions: initilized Skiplist
+// Return value: N/A
+// Functions called: appendRange
+template<class T, class Compare, class Allocator, bool Indexed>
+SkipList<T, Compare, Allocator, Indexed>::SkipList(initializer_list<T> vals, const Allocator& alloc) 
+   : SkipList(vals, Compare(), alloc) {}
+
+// Function purpose: To initialilize a SkipList using initializer_list and a comparator
+// Parameters: an initilization list, the comparator and the allocator used for nodes
+// Preconditions: comp is a strict weak ordering
+// Postconditions: initilized Skiplist
+// Return value: N/A
+// Functions called: appendRange
+template<class T, class Compare, class Allocator, bool Indexed>
+SkipList<T, Compare, Allocator, Indexed>::SkipList(initializer_list<T> vals, const Compare& comp, const Allocator& alloc) 
+   : SkipList(1, comp, alloc) {
+   appendRange(vals.begin(), vals.end());
+}
+
+// Function purpose: To initialize a SkipList from an iterator range
+// Parameters: Input iterators to the first and past the last item, and the allocator used for nodes
+// Preconditions: N/A
+// Postconditions: initilized SkipList holding the unique items of the range; O(n) if the range is 
+// strictly increasing
+// Return value: N/A
+// Functions called: appendRange
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class InputIt, class>
+SkipList<T, Compare, Allocator, Indexed>::SkipList(InputIt first, InputIt last, const Allocator& alloc) 
+   : SkipList(1, Compare(), alloc) {
+   appendRange(first, last);
+}
+
+// Function purpose: To initialize a SkipList from an iterator range and a comparator
+// Parameters: Input iterators to the first and past the last item, the comparator and the allocator used 
+// for nodes
+// Preconditions: comp is a strict weak ordering
+// Postconditions: initilized SkipList holding the unique items of the range; O(n) if the range is 
+// strictly increasing
+// Return value: N/A
+// Functions called: appendRange
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class InputIt, class>
+SkipList<T, Compare, Allocator, Indexed>::SkipList(InputIt first, InputIt last, const Compare& comp, const Allocator& alloc) 
+   : SkipList(1, comp, alloc) {
+   appendRange(first, last);
 }
 
 // Function purpose: To destroy a SkipList object after program execution
@@ -185,14 +323,16 @@ SkipList<T>::SkipList(initializer_list<T> vals) {
 // Preconditions: An initilized SkipList 
 // Postconditions: SkipList no longer exists in memory
 // Return value: N/A
-// Functions called: erase
-template<class T>
-SkipList<T>::~SkipList() {
+// Functions called: clear
+template<class T, class Compare, class Allocator, bool Indexed>
+SkipList<T, Compare, Allocator, Indexed>::~SkipList() {
    if (heads_ != nullptr && tails_ != nullptr) { clear(); }
    delete[] heads_;
    delete[] tails_;
+   delete[] headWidths_;
    heads_ = nullptr;
    tails_ = nullptr;
+   headWidths_ = nullptr;
 }
 
 // Function purpose: To initilize heads_ and tails_ pointers that were set to nullptr
@@ -201,18 +341,83 @@ SkipList<T>::~SkipList() {
 // Postconditions: Fields of current object have been reinitialized
 // Return value: void
 // Functions called: N/A
-template<class T>
-void SkipList<T>::initializeFields(const int maxLevel) {
+template<class T, class Compare, class Allocator, bool Indexed>
+void SkipList<T, Compare, Allocator, Indexed>::initializeFields(const int maxLevel) {
    maxLevel_ = maxLevel;
    size_ = 0;
    delete[] heads_;
    delete[] tails_;
+   delete[] headWidths_;
    heads_ = new SkipListNode*[maxLevel_];
    tails_ = new SkipListNode*[maxLevel_];
+   headWidths_ = Indexed ? new int[maxLevel_] : nullptr;
 
    for (int i = 0; i < maxLevel_; i++) {
       heads_[i] = nullptr;
       tails_[i] = nullptr;
+      if (Indexed) { headWidths_[i] = 1; }
+   }
+}
+
+// Function purpose: To add levels to heads_ and tails_
+// Parameters: An int for the new number of levels
+// Preconditions: maxLevel_ < newLevel <= MAX_LEVEL
+// Postconditions: heads_ and tails_ have newLevel entries; the new levels are empty
+// Return value: void
+// Functions called: N/A
+template<class T, class Compare, class Allocator, bool Indexed>
+void SkipList<T, Compare, Allocator, Indexed>::growLevels(int newLevel) {
+   SkipListNode **newHeads = new SkipListNode*[newLevel];
+   SkipListNode **newTails;
+   int *newWidths = nullptr;
+   try {
+      newTails = new SkipListNode*[newLevel];
+   }
+   catch (...) {
+      delete[] newHeads;
+      throw;
+   }
+   if (Indexed) {
+      try {
+         newWidths = new int[newLevel];
+      }
+      catch (...) {
+         delete[] newHeads;
+         delete[] newTails;
+         throw;
+      }
+   }
+   for (int i = 0; i < newLevel; i++) {
+      newHeads[i] = (i < maxLevel_) ? heads_[i] : nullptr;
+      newTails[i] = (i < maxLevel_) ? tails_[i] : nullptr;
+      // A new level is empty, so its head link spans every item
+      if (Indexed) { newWidths[i] = (i < maxLevel_) ? headWidths_[i] : size_ + 1; }
+   }
+   delete[] heads_;
+   delete[] tails_;
+   delete[] headWidths_;
+   heads_ = newHeads;
+   tails_ = newTails;
+   headWidths_ = newWidths;
+   maxLevel_ = newLevel;
+}
+
+// Function purpose: To add a level when the number of items outgrows the current levels
+// Parameters: N/A
+// Preconditions: Initialized SkipList
+// Postconditions: maxLevel_ is large enough for size_ items, or equal to MAX_LEVEL
+// Return value: void
+// Functions called: LevelGenerator::capacity, growLevels
+template<class T, class Compare, class Allocator, bool Indexed>
+void SkipList<T, Compare, Allocator, Indexed>::growIfNeeded() {
+   // log base 1/p of n levels keep the expected search length logarithmic
+   uint64_t items = static_cast<uint64_t>(size_);
+   if (maxLevel_ < MAX_LEVEL && items > levelGenerator_.capacity(maxLevel_)) {
+      int newLevel = maxLevel_ + 1;
+      while (newLevel < MAX_LEVEL && items > levelGenerator_.capacity(newLevel)) {
+         newLevel++;
+      }
+      growLevels(newLevel);
    }
 }
 
@@ -222,16 +427,20 @@ void SkipList<T>::initializeFields(const int maxLevel) {
 // Postconditions: copied Skiplist
 // Return value: N/A
 // Functions called: copyContents
-template<class T>
-SkipList<T>::SkipList(const SkipList<T>& toCopy) {
+template<class T, class Compare, class Allocator, bool Indexed>
+SkipList<T, Compare, Allocator, Indexed>::SkipList(const SkipList<T, Compare, Allocator, Indexed>& toCopy) 
+   : nodeAlloc_(NodeTraits::select_on_container_copy_construction(toCopy.nodeAlloc_)), 
+     comp_(toCopy.comp_), levelGenerator_(toCopy.levelGenerator_) {
    maxLevel_ = toCopy.maxLevel_;
    size_ = 0;
    heads_ = new SkipListNode*[maxLevel_];
    tails_ = new SkipListNode*[maxLevel_];
+   headWidths_ = Indexed ? new int[maxLevel_] : nullptr;
 
    for (int i = 0; i < maxLevel_; i++) {
       heads_[i] = nullptr;
       tails_[i] = nullptr;
+      if (Indexed) { headWidths_[i] = 1; }
    }
    copyContents(toCopy);
 }
@@ -242,8 +451,8 @@ SkipList<T>::SkipList(const SkipList<T>& toCopy) {
 // Postconditions: reassigned Skiplist
 // Return value: reference to SkipList
 // Functions called: initilizeFields
-template<class T>
-SkipList<T>& SkipList<T>::operator=(const SkipList<T>& rhs) {
+template<class T, class Compare, class Allocator, bool Indexed>
+SkipList<T, Compare, Allocator, Indexed>& SkipList<T, Compare, Allocator, Indexed>::operator=(const SkipList<T, Compare, Allocator, Indexed>& rhs) {
     if (this != &rhs) {
       if (heads_ == nullptr && tails_ == nullptr) {
          initializeFields(rhs.maxLevel_);
@@ -251,6 +460,11 @@ SkipList<T>& SkipList<T>::operator=(const SkipList<T>& rhs) {
       else {
          clear();
       }
+      if (NodeTraits::propagate_on_container_copy_assignment::value) {
+         nodeAlloc_ = rhs.nodeAlloc_;
+      }
+      comp_ = rhs.comp_;
+      levelGenerator_ = rhs.levelGenerator_;
       copyContents(rhs);
    }
    return *this;
@@ -259,29 +473,32 @@ SkipList<T>& SkipList<T>::operator=(const SkipList<T>& rhs) {
 // Function purpose: To move-construct a SkipList
 // Parameters: moved Skiplist
 // Preconditions: Initialized SkipList
-// Postconditions: Move constructed Skiplist
+// Postconditions: Move constructed Skiplist; toMove is an empty SkipList with one level
 // Return value: reference to SkipList
-// Functions called: N/A
-template<class T>
-SkipList<T>::SkipList(SkipList<T>&& toMove) {
+// Functions called: initializeFields
+template<class T, class Compare, class Allocator, bool Indexed>
+SkipList<T, Compare, Allocator, Indexed>::SkipList(SkipList<T, Compare, Allocator, Indexed>&& toMove) 
+   : nodeAlloc_(toMove.nodeAlloc_), comp_(toMove.comp_), levelGenerator_(toMove.levelGenerator_) {
    size_ = toMove.size_;
    maxLevel_ = toMove.maxLevel_;
    heads_ = toMove.heads_;
    tails_ = toMove.tails_;
-   toMove.size_ = 0;
-   toMove.maxLevel_ = 0;
+   headWidths_ = toMove.headWidths_;
+   // The moved-from SkipList is left empty with one level, so it can still be used or assigned to
    toMove.heads_ = nullptr;
    toMove.tails_ = nullptr;
+   toMove.headWidths_ = nullptr;
+   toMove.initializeFields(1);
 }
 
 // Function purpose: To move-assign a SkipList
 // Parameters: moved Skiplist as right hand argument
 // Preconditions: Initialized SkipLists
-// Postconditions: Moved Skiplist
+// Postconditions: Moved Skiplist; rhs is an empty SkipList with one level
 // Return value: reference to SkipList
 // Functions called: initilizeFields
-template<class T>
-SkipList<T>& SkipList<T>::operator=(SkipList<T>&& rhs) {
+template<class T, class Compare, class Allocator, bool Indexed>
+SkipList<T, Compare, Allocator, Indexed>& SkipList<T, Compare, Allocator, Indexed>::operator=(SkipList<T, Compare, Allocator, Indexed>&& rhs) {
    if (this != &rhs) {
       if (heads_ == nullptr && tails_ == nullptr) {
          initializeFields(rhs.maxLevel_);
@@ -289,16 +506,28 @@ SkipList<T>& SkipList<T>::operator=(SkipList<T>&& rhs) {
       else {
          clear();
       }
+      comp_ = rhs.comp_;
+      levelGenerator_ = rhs.levelGenerator_;
+      if (!NodeTraits::propagate_on_container_move_assignment::value && nodeAlloc_ != rhs.nodeAlloc_) {
+         // The nodes of rhs cannot be released through this allocator, so they are copied instead
+         copyContents(rhs);
+         return *this;
+      }
+      if (NodeTraits::propagate_on_container_move_assignment::value) {
+         nodeAlloc_ = rhs.nodeAlloc_;
+      }
       delete[] heads_;
       delete[] tails_;
+      delete[] headWidths_;
       size_ = rhs.size_;
       maxLevel_ = rhs.maxLevel_;
       heads_ = rhs.heads_;
       tails_ = rhs.tails_;
-      rhs.size_ = 0;
-      rhs.maxLevel_ = 0;
+      headWidths_ = rhs.headWidths_;
       rhs.heads_ = nullptr;
       rhs.tails_ = nullptr;
+      rhs.headWidths_ = nullptr;
+      rhs.initializeFields(1);
    }
    return *this;
 }
@@ -309,14 +538,14 @@ SkipList<T>& SkipList<T>::operator=(SkipList<T>&& rhs) {
 // Postconditions: bool reflecting whether objects are equal
 // Return value: N/A
 // Functions called: N/A
-template<class T>
-bool SkipList<T>::operator==(const SkipList<T>& rhs) const {
+template<class T, class Compare, class Allocator, bool Indexed>
+bool SkipList<T, Compare, Allocator, Indexed>::operator==(const SkipList<T, Compare, Allocator, Indexed>& rhs) const {
    const SkipListNode * ptr1 = this->heads_[0];
    const SkipListNode *ptr2 = rhs.heads_[0];
    while (ptr1 != nullptr && ptr2 != nullptr) {
-      if (ptr1->data_ != ptr2->data_) { return false; }
-      ptr1 = ptr1->next_;
-      ptr2 = ptr2->next_;
+      if (!(ptr1->data_ == ptr2->data_)) { return false; }
+      ptr1 = ptr1->next(0);
+      ptr2 = ptr2->next(0);
    }
    if (ptr1 == nullptr || ptr2 == nullptr) { return ptr1 == ptr2; }
    return true;
@@ -328,224 +557,1108 @@ bool SkipList<T>::operator==(const SkipList<T>& rhs) const {
 // Postconditions: bool reflecting whether objects are not equal
 // Return value: N/A
 // Functions called: operator==
-template<class T>
-bool SkipList<T>::operator!=(const SkipList<T>& rhs) const{
+template<class T, class Compare, class Allocator, bool Indexed>
+bool SkipList<T, Compare, Allocator, Indexed>::operator!=(const SkipList<T, Compare, Allocator, Indexed>& rhs) const{
    return !(*this == rhs);
 }
 
-// Function purpose: To insert a SkipListNode at a specific level in the SkipList
-// Parameters: Two SkipListNode pointers, and two data types
-// Preconditions: Pointers are not nullptrs and int level is > 0 
-// Postconditions: A SkipListNode is added to the level
-// Return value: void
-// Functions called: addBefore
-template<class T>
-void SkipList<T>::insertAtLevel(SkipListNode *newValue, SkipListNode *beforeNode, int const level, const T data) {
-   if (beforeNode == nullptr) { 
-      heads_[level] = newValue; 
-      tails_[level] = newValue;
-   }
-   else if (beforeNode->data_ > data) {
-      SkipListNode *nextNode = beforeNode;
-      heads_[level] = newValue;
-      addBefore(newValue, nextNode);
-   }
-   else if (beforeNode->next_ == nullptr) {
-      tails_[level] = newValue;
-      addBefore(beforeNode, newValue);
+// Function purpose: To allocate a SkipListNode and its forward pointers in a single block
+// Parameters: The number of levels the node occupies and the arguments of the constructor of T
+// Preconditions: height is > 0
+// Postconditions: A SkipListNode that is not linked into any level
+// Return value: SkipListNode pointer
+// Functions called: nodeSlots
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class... Args>
+typename SkipList<T, Compare, Allocator, Indexed>::SkipListNode* SkipList<T, Compare, Allocator, Indexed>::createNode(int height, 
+      Args&&... args) {
+   NodeSlot *block = NodeTraits::allocate(nodeAlloc_, nodeSlots(height));
+#ifdef SKIPLIST_STATS
+   allocatedNodeBytes_ += nodeSlots(height) * sizeof(NodeSlot);
+#endif
+   try {
+      return new (static_cast<void*>(block)) SkipListNode(height, std::forward<Args>(args)...);
    }
-   else {
-      SkipListNode *nextNode = beforeNode->next_;
-      addBefore(beforeNode, newValue);
-      addBefore(newValue, nextNode);
+   catch (...) {
+      NodeTraits::deallocate(nodeAlloc_, block, nodeSlots(height));
+      throw;
    }
 }
 
-// Function purpose: To determine whether to add a SkipListNode to the next level
-// Parameters: N/A
-// Preconditions: N/A
-// Postconditions: 1 or 0 has been returned, with a 50% chance of either
-// Return value: bool
+// Function purpose: To destroy a SkipListNode and release its block
+// Parameters: A SkipListNode pointer
+// Preconditions: Node was returned by createNode and is no longer linked
+// Postconditions: The node no longer exists in memory
+// Return value: void
+// Functions called: nodeSlots
+template<class T, class Compare, class Allocator, bool Indexed>
+void SkipList<T, Compare, Allocator, Indexed>::destroyNode(SkipListNode *node) {
+   int height = node->height_;
+   node->~SkipListNode();
+   NodeTraits::deallocate(nodeAlloc_, reinterpret_cast<NodeSlot*>(node), nodeSlots(height));
+}
+
+// Function purpose: To compute how many NodeSlots a node of a given height occupies
+// Parameters: An int for the height
+// Preconditions: height is > 0
+// Postconditions: N/A
+// Return value: size_t
 // Functions called: N/A
-template<class T>
-bool SkipList<T>::alsoHigher() const {
-   static default_random_engine generator;    
-   static bernoulli_distribution coin(0.5); 
-   return coin(generator);
+template<class T, class Compare, class Allocator, bool Indexed>
+size_t SkipList<T, Compare, Allocator, Indexed>::nodeSlots(int height) {
+   size_t bytes = sizeof(SkipListNode) + height * sizeof(SkipListNode*);
+   if (Indexed) { bytes += height * sizeof(int); }
+   return (bytes + sizeof(NodeSlot) - 1) / sizeof(NodeSlot);
 }
 
-// Function purpose: To insert a SkipListNode above a particular level in the SkipList
-// Parameters: an data type representing the itemto be added, a SkipListNode pointer, and a reference to 
-// a vector of before nodes
-// Preconditions: An item has been added to a SkipList
-// Postconditions: A SkipListNode is added to the level above
-// Return value: void
-// Functions called: alsoHigher, insertAtLevel, addAbove
-template<class T>
-void SkipList<T>::insertHigher(const T data, SkipListNode *base, vector<SkipListNode*>& beforeNodes) {
-   int currentLevel = 1;
-   while (alsoHigher() && currentLevel < maxLevel_) {
-      SkipListNode *newValue = new SkipListNode(data);
-      insertAtLevel(newValue, beforeNodes[currentLevel], currentLevel, data);
-      addAbove(newValue, base);
-      currentLevel++;
-      base = newValue;
-   }
-}
-
-// Function purpose: To connect two SkipLIstNodes using prev_ and next_ pointers
-// Parameters: Two SkipListNode pointers
-// Preconditions: Parameters are not nullptrs
-// Postconditions: Two horizontally connected SkipListNodes
-// Return value: void
+// Function purpose: To return the node following a predecessor at a given level
+// Parameters: A SkipListNode pointer (nullptr stands for the head of the level) and an int for the level
+// Preconditions: pred occupies the level if it is not nullptr
+// Postconditions: N/A
+// Return value: SkipListNode pointer
 // Functions called: N/A
-template<class T>
-void SkipList<T>::addBefore(SkipListNode *newNode, SkipListNode *nextNode) {
-   if (newNode != nullptr && nextNode != nullptr) {
-      newNode->next_ = nextNode;
-      nextNode->prev_ = newNode;
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::SkipListNode* SkipList<T, Compare, Allocator, Indexed>::successor(SkipListNode *pred, int level) const {
+   return (pred == nullptr) ? heads_[level] : pred->next(level);
+}
+
+// Function purpose: To insert a SkipListNode at a specific level in the SkipList
+// Parameters: The new SkipListNode pointer, its predecessor (nullptr for the head) and the level
+// Preconditions: newValue is not a nullptr and 0 <= level < newValue->height_
+// Postconditions: A SkipListNode is added to the level
+// Return value: void
+// Functions called: successor
+template<class T, class Compare, class Allocator, bool Indexed>
+void SkipList<T, Compare, Allocator, Indexed>::insertAtLevel(SkipListNode *newValue, SkipListNode *beforeNode, int const level) {
+   SkipListNode *nextNode = successor(beforeNode, level);
+   newValue->next(level) = nextNode;
+   if (beforeNode == nullptr) { heads_[level] = newValue; }
+   else { beforeNode->next(level) = newValue; }
+   if (nextNode == nullptr) { tails_[level] = newValue; }
+   if (level == 0) {
+      newValue->prev_ = beforeNode;
+      if (nextNode != nullptr) { nextNode->prev_ = newValue; }
    }
 }
 
-// Function purpose: To connect two SkipLIstNodes using upLevel_ and downLevel_ pointers
-// Parameters: Two SkipListNode pointers
-// Preconditions: Parameters are not nullptrs
-// Postconditions: Two vertically connected SkipListNodes
+// Function purpose: To unlink a SkipListNode from a specific level in the SkipList
+// Parameters: The SkipListNode pointer to remove, its predecessor (nullptr for the head) and the level
+// Preconditions: toRemove is linked at the level directly after beforeNode
+// Postconditions: The SkipListNode is no longer reachable at the level
 // Return value: void
 // Functions called: N/A
-template<class T>
-void SkipList<T>::addAbove(SkipListNode *newNode, SkipListNode *belowNode) {
-   if (newNode != nullptr && belowNode != nullptr) {
-      newNode->downLevel_ = belowNode;
-      belowNode->upLevel_ = newNode;
+template<class T, class Compare, class Allocator, bool Indexed>
+void SkipList<T, Compare, Allocator, Indexed>::removeAtLevel(SkipListNode *toRemove, SkipListNode *beforeNode, int const level) {
+   SkipListNode *nextNode = toRemove->next(level);
+   if (beforeNode == nullptr) { heads_[level] = nextNode; }
+   else { beforeNode->next(level) = nextNode; }
+   if (nextNode == nullptr) { tails_[level] = beforeNode; }
+   if (level == 0 && nextNode != nullptr) { nextNode->prev_ = beforeNode; }
+}
+
+// Function purpose: To return the width of the link that leaves a predecessor at a given level
+// Parameters: A SkipListNode pointer (nullptr stands for the head of the level) and an int for the level
+// Preconditions: Indexed is true
+// Postconditions: N/A
+// Return value: reference to the width; a link to nullptr spans up to position size_ + 1
+// Functions called: SkipListNode::width
+template<class T, class Compare, class Allocator, bool Indexed>
+int& SkipList<T, Compare, Allocator, Indexed>::linkWidth(SkipListNode *pred, int level) const {
+   return (pred == nullptr) ? headWidths_[level] : pred->width(level);
+}
+
+// Function purpose: To find the last node before an item on every level
+// Parameters: An item to search for and a SearchPath with maxLevel_ levels to receive the predecessors
+// Preconditions: Initialized SkipList
+// Postconditions: beforeNodes.nodes_[i] is the last node on level i that is less than data (nullptr for 
+// the head) and, if Indexed, beforeNodes.ranks_[i] is its position (0 for the head)
+// Return value: The first node on the lowest level that is not less than data, or nullptr
+// Functions called: successor, linkWidth
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class K>
+typename SkipList<T, Compare, Allocator, Indexed>::SkipListNode* SkipList<T, Compare, Allocator, Indexed>::findPredecessors(const K& data, 
+      SearchPath& beforeNodes) const {
+   SkipListNode *pred = nullptr;
+   SkipListNode *curr = nullptr;
+   int rank = 0;
+   for (int i = maxLevel_ - 1; i >= 0; i--) {
+      curr = successor(pred, i);
+      while (curr != nullptr && comp_(curr->data_, data)) {
+         countSearch(1, 1);
+         if (Indexed) { rank += linkWidth(pred, i); }
+         pred = curr;
+         curr = curr->next(i);
+      }
+      countSearch(curr != nullptr ? 1 : 0, 0);
+      beforeNodes.nodes_[i] = pred;
+      if (Indexed) { beforeNodes.ranks_[i] = rank; }
    }
+   return curr;
 }
 
-// Function purpose: To add a SkipListNode containing a unique item to a SkipList
-// Parameters: An item to add to a SkipListNode that is placed in the SkipList
-// Preconditions: Any numerical parameters are less than extreme values; an initilized SkipList
-// Postconditions: A bool reflecting the success of the insertion operation
-// Return value: bool
-// Functions called: contains, insertAtLevel, insertHigher
-template<class T>
-bool SkipList<T>::insert(T data) {
-   bool containsValue = contains(data);
-   if (containsValue) {
-      cout << "Error: '" << data << "' has already been added" << endl;
+// Function purpose: To find the last node that is not greater than an item on every level
+// Parameters: An item to search for and a SearchPath with maxLevel_ levels to receive the predecessors
+// Preconditions: Initialized SkipList
+// Postconditions: beforeNodes.nodes_[i] is the last node on level i that is not greater than data 
+// (nullptr for the head) and, if Indexed, beforeNodes.ranks_[i] is its position (0 for the head)
+// Return value: The first node on the lowest level that is greater than data, or nullptr
+// Functions called: successor, linkWidth
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class K>
+typename SkipList<T, Compare, Allocator, Indexed>::SkipListNode* SkipList<T, Compare, Allocator, Indexed>::findUpperPredecessors(const K& data, 
+      SearchPath& beforeNodes) const {
+   SkipListNode *pred = nullptr;
+   SkipListNode *curr = nullptr;
+   int rank = 0;
+   for (int i = maxLevel_ - 1; i >= 0; i--) {
+      curr = successor(pred, i);
+      while (curr != nullptr && !comp_(data, curr->data_)) {
+         countSearch(1, 1);
+         if (Indexed) { rank += linkWidth(pred, i); }
+         pred = curr;
+         curr = curr->next(i);
+      }
+      countSearch(curr != nullptr ? 1 : 0, 0);
+      beforeNodes.nodes_[i] = pred;
+      if (Indexed) { beforeNodes.ranks_[i] = rank; }
    }
-   else {
-      SkipListNode *newValue = new SkipListNode(data);
-      int currentIndex = maxLevel_ - 1;
-      SkipListNode *curr = heads_[currentIndex];
-      vector <SkipListNode*> beforeNodes(maxLevel_);
-
-      while ((curr == nullptr || curr->data_ > data) && currentIndex > 0) {
-         beforeNodes[currentIndex] = curr;
-         currentIndex--;
-         curr = heads_[currentIndex];
-      }
-      if (curr != nullptr) {
-         for (int i = currentIndex; i >= 0; i--) {
-            while (curr->next_ != nullptr && curr->next_->data_ < data) { 
-               curr = curr->next_; 
+   return curr;
+}
+
+// Function purpose: To find the node at a position and, optionally, its predecessor on every level
+// Parameters: A 0-based index and a SearchPath with maxLevel_ levels, or nullptr
+// Preconditions: Indexed is true and 0 <= index < size_
+// Postconditions: beforeNodes, if given, holds the predecessors of the node and their positions
+// Return value: SkipListNode pointer
+// Functions called: successor, linkWidth
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::SkipListNode* SkipList<T, Compare, Allocator, Indexed>::findIndex(int index, 
+      SearchPath *beforeNodes) const {
+   // Positions are 1-based so that the head is at 0; the node at index is the one at position index + 1
+   SkipListNode *pred = nullptr;
+   int rank = 0;
+   for (int i = maxLevel_ - 1; i >= 0; i--) {
+      while (successor(pred, i) != nullptr && rank + linkWidth(pred, i) <= index) {
+         rank += linkWidth(pred, i);
+         pred = successor(pred, i);
+      }
+      if (beforeNodes != nullptr) {
+         beforeNodes->nodes_[i] = pred;
+         beforeNodes->ranks_[i] = rank;
+      }
+   }
+   return successor(pred, 0);
+}
+
+// Function purpose: To find the predecessors of an item starting from the predecessors of an earlier search
+// Parameters: An item to search for and a SearchPath left by an earlier search (or all heads)
+// Preconditions: Initialized SkipList; finger has an entry for every level
+// Postconditions: finger holds the predecessors of data and, if Indexed, their positions
+// Return value: The first node on the lowest level that is not less than data, or nullptr
+// Functions called: successor, linkWidth
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class K>
+typename SkipList<T, Compare, Allocator, Indexed>::SkipListNode* SkipList<T, Compare, Allocator, Indexed>::fingerSearch(const K& data, 
+      SearchPath& finger) const {
+   if (finger.nodes_[0] != nullptr && !comp_(finger.nodes_[0]->data_, data)) {
+      // The finger is not before data, so the search starts over from the heads
+      for (int i = 0; i < maxLevel_; i++) {
+         finger.nodes_[i] = nullptr;
+         if (Indexed) { finger.ranks_[i] = 0; }
+      }
+   }
+   // Every node of the finger is before data, so the search climbs from the lowest level only as far as it 
+   // has to travel and descends from there
+   int level = 0;
+   while (level + 1 < maxLevel_) {
+      SkipListNode *next = successor(finger.nodes_[level], level);
+      if (next == nullptr || !comp_(next->data_, data)) { break; }
+      level++;
+   }
+   SkipListNode *pred = nullptr;
+   SkipListNode *curr = nullptr;
+   int rank = 0;
+   bool moved = false;
+   for (int i = level; i >= 0; i--) {
+      // Until the search moves right, the finger on the lower level is the furthest valid start
+      if (!moved) {
+         pred = finger.nodes_[i];
+         if (Indexed) { rank = finger.ranks_[i]; }
+      }
+      curr = successor(pred, i);
+      while (curr != nullptr && comp_(curr->data_, data)) {
+         if (Indexed) { rank += linkWidth(pred, i); }
+         pred = curr;
+         curr = curr->next(i);
+         moved = true;
+      }
+      finger.nodes_[i] = pred;
+      if (Indexed) { finger.ranks_[i] = rank; }
+   }
+   return curr;
+}
+
+// Function purpose: To find the first node that is not less than each key of a batch
+// Parameters: Forward iterators to the first and past the last key, and a function called with the node 
+// found and the key, in the order of the keys
+// Preconditions: Initialized SkipList
+// Postconditions: visit has been called once per key
+// Return value: void
+// Functions called: fingerSearch, successor
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class ForwardIt, class Visitor>
+void SkipList<T, Compare, Allocator, Indexed>::searchBatch(ForwardIt first, ForwardIt last, Visitor visit) const {
+   if (is_sorted(first, last, comp_)) {
+      SearchPath finger(maxLevel_);
+      for (; first != last; ++first) {
+         visit(fingerSearch(*first, finger), *first);
+      }
+      return;
+   }
+
+   // Unordered keys are searched BATCH_WIDTH at a time. Each search takes one step per round and prefetches 
+   // the node that its next step reads, so the other searches run while that node is being fetched.
+   while (first != last) {
+      ForwardIt keys[BATCH_WIDTH];
+      SkipListNode *preds[BATCH_WIDTH];
+      SkipListNode *found[BATCH_WIDTH];
+      int levels[BATCH_WIDTH];
+      int count = 0;
+      for (; first != last && count < BATCH_WIDTH; ++first, ++count) {
+         keys[count] = first;
+         preds[count] = nullptr;
+         found[count] = nullptr;
+         levels[count] = maxLevel_ - 1;
+      }
+      if (heads_[maxLevel_ - 1] != nullptr) { __builtin_prefetch(heads_[maxLevel_ - 1]); }
+      int active = count;
+      while (active > 0) {
+         for (int j = 0; j < count; j++) {
+            if (levels[j] < 0) { continue; }
+            SkipListNode *curr = successor(preds[j], levels[j]);
+            if (curr != nullptr && comp_(curr->data_, *keys[j])) {
+               preds[j] = curr;
             }
-            beforeNodes[i] = curr;
-            if (i > 0) { curr = curr->downLevel_; }
+            else if (levels[j] == 0) {
+               found[j] = curr;
+               levels[j] = -1;
+               active--;
+               continue;
+            }
+            else {
+               levels[j]--;
+            }
+            SkipListNode *next = successor(preds[j], levels[j]);
+            if (next != nullptr) { __builtin_prefetch(next); }
          }
       }
-      insertAtLevel(newValue, beforeNodes[0], 0, data);
-      insertHigher(data, newValue, beforeNodes);
-      size_ += 1;
+      for (int j = 0; j < count; j++) {
+         visit(found[j], *keys[j]);
+      }
+   }
+}
+
+// Function purpose: To link a new node after its predecessors on every level it occupies
+// Parameters: The new SkipListNode pointer and the predecessors found by findPredecessors
+// Preconditions: The predecessors were found for the item of newValue and nothing was linked since
+// Postconditions: The node is in the SkipList, link widths are updated and size_ has been incremented
+// Return value: void
+// Functions called: insertAtLevel, linkWidth, growIfNeeded
+template<class T, class Compare, class Allocator, bool Indexed>
+void SkipList<T, Compare, Allocator, Indexed>::linkNode(SkipListNode *newValue, SearchPath& beforeNodes) {
+   for (int i = 0; i < newValue->height_; i++) {
+      insertAtLevel(newValue, beforeNodes.nodes_[i], i);
+   }
+   if (Indexed) {
+      // The new node splits the links it is placed under and lengthens every link that passes over it
+      int position = beforeNodes.ranks_[0] + 1;
+      for (int i = 0; i < maxLevel_; i++) {
+         int &predWidth = linkWidth(beforeNodes.nodes_[i], i);
+         if (i < newValue->height_) {
+            newValue->width(i) = predWidth - (position - beforeNodes.ranks_[i]) + 1;
+            predWidth = position - beforeNodes.ranks_[i];
+         }
+         else {
+            predWidth += 1;
+         }
+      }
+   }
+   size_ += 1;
+   growIfNeeded();
+}
+
+// Function purpose: To unlink a node from every level it occupies and destroy it
+// Parameters: The SkipListNode pointer to remove and the predecessors found by findPredecessors
+// Preconditions: toRemove is the node returned by findPredecessors for the same search
+// Postconditions: The node no longer exists, link widths are updated and size_ has been decremented
+// Return value: void
+// Functions called: removeAtLevel, linkWidth, destroyNode
+template<class T, class Compare, class Allocator, bool Indexed>
+void SkipList<T, Compare, Allocator, Indexed>::unlinkNode(SkipListNode *toRemove, SearchPath& beforeNodes) {
+   if (Indexed) {
+      for (int i = 0; i < maxLevel_; i++) {
+         int &predWidth = linkWidth(beforeNodes.nodes_[i], i);
+         predWidth += (i < toRemove->height_) ? toRemove->width(i) - 1 : -1;
+      }
+   }
+   for (int i = toRemove->height_ - 1; i >= 0; i--) {
+      removeAtLevel(toRemove, beforeNodes.nodes_[i], i);
+   }
+   destroyNode(toRemove);
+   size_ -= 1;
+}
+
+// Function purpose: To unlink and destroy every node between two sets of predecessors
+// Parameters: The predecessors of the first node to remove and the predecessors of the first node to keep
+// Preconditions: Both were found on the current links and after is not before before on any level
+// Postconditions: Each level links its node of before to the node following its node of after, link 
+// widths are updated and size_ has been reduced
+// Return value: int for the number of nodes removed
+// Functions called: successor, linkWidth, destroyNode
+template<class T, class Compare, class Allocator, bool Indexed>
+int SkipList<T, Compare, Allocator, Indexed>::eraseBetween(SearchPath& before, SearchPath& after) {
+   SkipListNode *first = successor(before.nodes_[0], 0);
+   SkipListNode *stop = successor(after.nodes_[0], 0);
+   if (first == stop) { return 0; }
+
+   // On every level the node of before is linked straight to the node that follows the node of after
+   int removed = Indexed ? after.ranks_[0] - before.ranks_[0] : 0;
+   for (int i = 0; i < maxLevel_; i++) {
+      SkipListNode *pred = before.nodes_[i];
+      SkipListNode *nextNode = successor(after.nodes_[i], i);
+      if (Indexed) {
+         linkWidth(pred, i) = after.ranks_[i] + linkWidth(after.nodes_[i], i) - before.ranks_[i] - removed;
+      }
+      if (pred == nullptr) { heads_[i] = nextNode; }
+      else { pred->next(i) = nextNode; }
+      if (nextNode == nullptr) { tails_[i] = pred; }
+   }
+   if (stop != nullptr) { stop->prev_ = before.nodes_[0]; }
+
+   // The removed nodes are still chained together on the lowest level
+   removed = 0;
+   while (first != stop) {
+      SkipListNode *next = first->next(0);
+      destroyNode(first);
+      first = next;
+      removed++;
+   }
+   size_ -= removed;
+   return removed;
+}
+
+// Function purpose: To choose the number of levels a new SkipListNode occupies
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: A height between 1 and maxLevel_ has been returned
+// Return value: int
+// Functions called: LevelGenerator::height
+template<class T, class Compare, class Allocator, bool Indexed>
+int SkipList<T, Compare, Allocator, Indexed>::randomHeight() {
+   return levelGenerator_.height(maxLevel_);
+}
+
+// Function purpose: To add an item unless an equal item is in the SkipList
+// Parameters: An item, forwarded so that an rvalue is moved into the new node
+// Preconditions: Initialized SkipList
+// Postconditions: The item is in the SkipList; data is left untouched if it already was
+// Return value: pair of an iterator to the item and a bool that is true if the item was inserted
+// Functions called: findPredecessors, randomHeight, createNode, linkNode
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class U>
+pair<typename SkipList<T, Compare, Allocator, Indexed>::iterator, bool> SkipList<T, Compare, Allocator, Indexed>::insertUnique(U&& data) {
+   SearchPath beforeNodes(maxLevel_);
+   beginSearch();
+   SkipListNode *found = findPredecessors(data, beforeNodes);
+   finishSearch(StatsOperation::INSERT);
+   if (found != nullptr && !comp_(data, found->data_)) {
+      return make_pair(iterator(this, found), false);
+   }
+   SkipListNode *newValue = createNode(randomHeight(), std::forward<U>(data));
+   linkNode(newValue, beforeNodes);
+   return make_pair(iterator(this, newValue), true);
+}
+
+// Function purpose: To add a SkipListNode containing a unique item to a SkipList
+// Parameters: An item to copy or move into a SkipListNode that is placed in the SkipList
+// Preconditions: An initilized SkipList
+// Postconditions: The item is in the SkipList; it is only copied or moved if it was not already there
+// Return value: pair of an iterator to the item and a bool that is true if the item was inserted
+// Functions called: insertUnique
+template<class T, class Compare, class Allocator, bool Indexed>
+pair<typename SkipList<T, Compare, Allocator, Indexed>::iterator, bool> SkipList<T, Compare, Allocator, Indexed>::insert(const T& data) {
+   return insertUnique(data);
+}
+
+template<class T, class Compare, class Allocator, bool Indexed>
+pair<typename SkipList<T, Compare, Allocator, Indexed>::iterator, bool> SkipList<T, Compare, Allocator, Indexed>::insert(T&& data) {
+   return insertUnique(std::move(data));
+}
+
+// Function purpose: To construct an item in place inside a new SkipListNode and add it to the SkipList
+// Parameters: The arguments of the constructor of T
+// Preconditions: An initilized SkipList
+// Postconditions: The item is in the SkipList; the new node is destroyed if an equal item was already there
+// Return value: pair of an iterator to the item and a bool that is true if the item was inserted
+// Functions called: createNode, randomHeight, findPredecessors, linkNode, destroyNode
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class... Args>
+pair<typename SkipList<T, Compare, Allocator, Indexed>::iterator, bool> SkipList<T, Compare, Allocator, Indexed>::emplace(Args&&... args) {
+   // The item has to exist before it can be compared, so the node is built first and searched for by its own item
+   SkipListNode *newValue = createNode(randomHeight(), std::forward<Args>(args)...);
+   SearchPath beforeNodes(maxLevel_);
+   beginSearch();
+   SkipListNode *found = findPredecessors(newValue->data_, beforeNodes);
+   finishSearch(StatsOperation::INSERT);
+   if (found != nullptr && !comp_(newValue->data_, found->data_)) {
+      destroyNode(newValue);
+      return make_pair(iterator(this, found), false);
    }
-   return containsValue;
+   linkNode(newValue, beforeNodes);
+   return make_pair(iterator(this, newValue), true);
 }
 
 // Function purpose: To check if the SkipList contains a given item
 // Parameters: An item to search for 
-// Preconditions: Numerical parameters are less than extreme values 
+// Preconditions: Initialized SkipList
 // Postconditions: A bool reflecting the existance of the object in the SkipList
 // Return value: bool
-// Functions called: N/A
-template<class T>
-bool SkipList<T>::contains(T data) const {
-  int topIndex = this->maxLevel_ - 1;
-   SkipListNode *curr = this->heads_[topIndex];
-   int currentIndex = topIndex;
-   while ((curr == nullptr || curr->data_ > data) && currentIndex > 0) {
-      currentIndex--;
-      curr = this->heads_[currentIndex];
-   }
-   for (int i = currentIndex; i >= 0; i--) {
-      if (curr != nullptr && curr->data_ <= data) {     
-         while (curr->next_ != nullptr && curr->next_->data_ <= data) {
-            curr = curr->next_; 
-         }
-         if (curr->data_ == data) { return true; }
-         else if (i > 0) { curr = curr->downLevel_; }
+// Functions called: lowerBoundNode
+template<class T, class Compare, class Allocator, bool Indexed>
+bool SkipList<T, Compare, Allocator, Indexed>::contains(const T& data) const {
+   beginSearch();
+   SkipListNode *curr = lowerBoundNode(data);
+   finishSearch(StatsOperation::CONTAINS);
+   return curr != nullptr && !comp_(data, curr->data_);
+}
+
+// Function purpose: To find the first node that is not less than an item
+// Parameters: An item to search for
+// Preconditions: Initialized SkipList
+// Postconditions: N/A
+// Return value: SkipListNode pointer, or nullptr if every item is less than data
+// Functions called: successor
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class K>
+typename SkipList<T, Compare, Allocator, Indexed>::SkipListNode* SkipList<T, Compare, Allocator, Indexed>::lowerBoundNode(const K& data) const {
+   SkipListNode *pred = nullptr;
+   SkipListNode *curr = nullptr;
+   for (int i = maxLevel_ - 1; i >= 0; i--) {
+      curr = successor(pred, i);
+      while (curr != nullptr && comp_(curr->data_, data)) {
+         countSearch(1, 1);
+         pred = curr;
+         curr = curr->next(i);
       }
+      countSearch(curr != nullptr ? 1 : 0, 0);
    }
-   return false; 
+   return curr;
+}
+
+// Function purpose: To find the first node that is greater than an item
+// Parameters: An item to search for
+// Preconditions: Initialized SkipList
+// Postconditions: N/A
+// Return value: SkipListNode pointer, or nullptr if no item is greater than data
+// Functions called: successor
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class K>
+typename SkipList<T, Compare, Allocator, Indexed>::SkipListNode* SkipList<T, Compare, Allocator, Indexed>::upperBoundNode(const K& data) const {
+   SkipListNode *pred = nullptr;
+   SkipListNode *curr = nullptr;
+   for (int i = maxLevel_ - 1; i >= 0; i--) {
+      curr = successor(pred, i);
+      while (curr != nullptr && !comp_(data, curr->data_)) {
+         pred = curr;
+         curr = curr->next(i);
+      }
+   }
+   return curr;
+}
+
+// Function purpose: To locate a given item
+// Parameters: An item to search for
+// Preconditions: Initialized SkipList
+// Postconditions: N/A
+// Return value: iterator to the item, or end() if it is not in the SkipList
+// Functions called: lowerBoundNode
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::iterator SkipList<T, Compare, Allocator, Indexed>::find(const T& data) const {
+   SkipListNode *curr = lowerBoundNode(data);
+   if (curr != nullptr && comp_(data, curr->data_)) { curr = nullptr; }
+   return iterator(this, curr);
+}
+
+// Function purpose: To locate the first item that is not less than a given item
+// Parameters: An item to search for
+// Preconditions: Initialized SkipList
+// Postconditions: N/A
+// Return value: iterator, or end() if every item is less than data
+// Functions called: lowerBoundNode
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::iterator SkipList<T, Compare, Allocator, Indexed>::lower_bound(const T& data) const {
+   return iterator(this, lowerBoundNode(data));
+}
+
+// Function purpose: To locate the first item that is greater than a given item
+// Parameters: An item to search for
+// Preconditions: Initialized SkipList
+// Postconditions: N/A
+// Return value: iterator, or end() if no item is greater than data
+// Functions called: upperBoundNode
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::iterator SkipList<T, Compare, Allocator, Indexed>::upper_bound(const T& data) const {
+   return iterator(this, upperBoundNode(data));
+}
+
+// Function purpose: To locate the items equal to a given item
+// Parameters: An item to search for
+// Preconditions: Initialized SkipList
+// Postconditions: N/A
+// Return value: pair of lower_bound(data) and the iterator after it if it holds data, or two equal iterators
+// Functions called: lowerBoundNode
+template<class T, class Compare, class Allocator, bool Indexed>
+pair<typename SkipList<T, Compare, Allocator, Indexed>::iterator, typename SkipList<T, Compare, Allocator, Indexed>::iterator> 
+SkipList<T, Compare, Allocator, Indexed>::equal_range(const T& data) const {
+   const SkipList<T, Compare, Allocator, Indexed> *self = this;
+   SkipListNode *first = lowerBoundNode(data);
+   // Items are unique, so at most one node can compare equal
+   SkipListNode *last = (first != nullptr && !comp_(data, first->data_)) ? first->next(0) : first;
+   return make_pair(iterator(self, first), iterator(self, last));
+}
+
+// Function purpose: To return a view over the items in the half-open interval [low, high)
+// Parameters: The lower and upper bound of the interval
+// Preconditions: Initialized SkipList
+// Postconditions: N/A
+// Return value: range_view, which is empty if high is not greater than low
+// Functions called: lowerBoundNode
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::range_view SkipList<T, Compare, Allocator, Indexed>::range(const T& low, const T& high) const {
+   const SkipList<T, Compare, Allocator, Indexed> *self = this;
+   SkipListNode *first = lowerBoundNode(low);
+   SkipListNode *last = comp_(low, high) ? lowerBoundNode(high) : first;
+   return range_view(iterator(self, first), iterator(self, last));
+}
+
+// Function purpose: To check if the SkipList contains an item equivalent to a key of another type
+// Parameters: A key that Compare can order against T
+// Preconditions: Compare::is_transparent is defined
+// Postconditions: A bool reflecting the existance of an equivalent item in the SkipList
+// Return value: bool
+// Functions called: lowerBoundNode
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class K, class C, class>
+bool SkipList<T, Compare, Allocator, Indexed>::contains(const K& key) const {
+   beginSearch();
+   SkipListNode *curr = lowerBoundNode(key);
+   finishSearch(StatsOperation::CONTAINS);
+   return curr != nullptr && !comp_(key, curr->data_);
+}
+
+// Function purpose: To locate the item equivalent to a key of another type
+// Parameters: A key that Compare can order against T
+// Preconditions: Compare::is_transparent is defined
+// Postconditions: N/A
+// Return value: iterator to the item, or end() if there is none
+// Functions called: lowerBoundNode
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class K, class C, class>
+typename SkipList<T, Compare, Allocator, Indexed>::iterator SkipList<T, Compare, Allocator, Indexed>::find(const K& key) const {
+   SkipListNode *curr = lowerBoundNode(key);
+   if (curr != nullptr && comp_(key, curr->data_)) { curr = nullptr; }
+   return iterator(this, curr);
+}
+
+// Function purpose: To locate the first item that is not less than a key of another type
+// Parameters: A key that Compare can order against T
+// Preconditions: Compare::is_transparent is defined
+// Postconditions: N/A
+// Return value: iterator, or end() if every item is less than key
+// Functions called: lowerBoundNode
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class K, class C, class>
+typename SkipList<T, Compare, Allocator, Indexed>::iterator SkipList<T, Compare, Allocator, Indexed>::lower_bound(const K& key) const {
+   return iterator(this, lowerBoundNode(key));
+}
+
+// Function purpose: To locate the first item that is greater than a key of another type
+// Parameters: A key that Compare can order against T
+// Preconditions: Compare::is_transparent is defined
+// Postconditions: N/A
+// Return value: iterator, or end() if no item is greater than key
+// Functions called: upperBoundNode
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class K, class C, class>
+typename SkipList<T, Compare, Allocator, Indexed>::iterator SkipList<T, Compare, Allocator, Indexed>::upper_bound(const K& key) const {
+   return iterator(this, upperBoundNode(key));
+}
+
+// Function purpose: To locate the items equivalent to a key of another type
+// Parameters: A key that Compare can order against T
+// Preconditions: Compare::is_transparent is defined
+// Postconditions: N/A
+// Return value: pair of iterators bounding the equivalent items
+// Functions called: lowerBoundNode, upperBoundNode
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class K, class C, class>
+pair<typename SkipList<T, Compare, Allocator, Indexed>::iterator, typename SkipList<T, Compare, Allocator, Indexed>::iterator> 
+SkipList<T, Compare, Allocator, Indexed>::equal_range(const K& key) const {
+   const SkipList<T, Compare, Allocator, Indexed> *self = this;
+   // A transparent comparator may treat several items as equivalent to key, so both bounds are searched
+   return make_pair(iterator(self, lowerBoundNode(key)), iterator(self, upperBoundNode(key)));
+}
+
+// Function purpose: To return a view over the items in [low, high) for keys of another type
+// Parameters: The lower and upper bound of the interval
+// Preconditions: Compare::is_transparent is defined
+// Postconditions: N/A
+// Return value: range_view, which is empty if high is not greater than low
+// Functions called: lowerBoundNode
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class K, class C, class>
+typename SkipList<T, Compare, Allocator, Indexed>::range_view SkipList<T, Compare, Allocator, Indexed>::range(const K& low, 
+      const K& high) const {
+   const SkipList<T, Compare, Allocator, Indexed> *self = this;
+   SkipListNode *first = lowerBoundNode(low);
+   SkipListNode *last = comp_(low, high) ? lowerBoundNode(high) : first;
+   return range_view(iterator(self, first), iterator(self, last));
+}
+
+// Function purpose: To check if the SkipList contains each key of a batch
+// Parameters: Forward iterators to the first and past the last key, and an output iterator for the results
+// Preconditions: Initialized SkipList; result can receive one bool per key
+// Postconditions: One bool per key has been written to result, in the order of the keys
+// Return value: Output iterator past the last result
+// Functions called: searchBatch
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class ForwardIt, class OutputIt>
+OutputIt SkipList<T, Compare, Allocator, Indexed>::contains_batch(ForwardIt first, ForwardIt last, OutputIt result) const {
+   searchBatch(first, last, [&](SkipListNode *node, const auto &key) {
+      *result = node != nullptr && !comp_(key, node->data_);
+      ++result;
+   });
+   return result;
+}
+
+// Function purpose: To locate each key of a batch
+// Parameters: Forward iterators to the first and past the last key, and an output iterator for the results
+// Preconditions: Initialized SkipList; result can receive one iterator per key
+// Postconditions: One iterator per key, end() if the key is absent, has been written to result in the 
+// order of the keys
+// Return value: Output iterator past the last result
+// Functions called: searchBatch
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class ForwardIt, class OutputIt>
+OutputIt SkipList<T, Compare, Allocator, Indexed>::find_batch(ForwardIt first, ForwardIt last, OutputIt result) const {
+   const SkipList<T, Compare, Allocator, Indexed> *self = this;
+   searchBatch(first, last, [&](SkipListNode *node, const auto &key) {
+      bool match = node != nullptr && !comp_(key, node->data_);
+      *result = iterator(self, match ? node : nullptr);
+      ++result;
+   });
+   return result;
 }
 
 // Function purpose: To remove a SkipListNode containing a given item from the SkipList
 // Parameters: An item that is stored in a SkipListNode within the SkipList
-// Preconditions: Parameter exists in the SkipList; an initilized SkipList
-// Postconditions: A bool reflecting the success of the erase operation
-// Return value: bool
-// Functions called: contains, addBefore
-template<class T>
-bool SkipList<T>::erase(T data) {
-   bool containsValue = contains(data);
-   if (!containsValue) {
-      cout << "Error: Does not contain value to be erased" << endl;
+// Preconditions: An initilized SkipList
+// Postconditions: The item is no longer in the SkipList
+// Return value: int for the number of items removed (0 or 1)
+// Functions called: findPredecessors, unlinkNode
+template<class T, class Compare, class Allocator, bool Indexed>
+int SkipList<T, Compare, Allocator, Indexed>::erase(const T& data) {
+   SearchPath locations(maxLevel_);
+   beginSearch();
+   SkipListNode *toDelete = findPredecessors(data, locations);
+   finishSearch(StatsOperation::ERASE);
+   if (toDelete == nullptr || comp_(data, toDelete->data_)) {
+      return 0;
+   }
+   unlinkNode(toDelete, locations);
+   return 1;
+}
+
+// Function purpose: To remove every item in the half-open interval [low, high)
+// Parameters: The lower and upper bound of the interval
+// Preconditions: Initialized SkipList
+// Postconditions: No item in [low, high) is in the SkipList
+// Return value: int for the number of items removed
+// Functions called: findPredecessors, fingerSearch, eraseBetween
+template<class T, class Compare, class Allocator, bool Indexed>
+int SkipList<T, Compare, Allocator, Indexed>::erase(const T& low, const T& high) {
+   if (!comp_(low, high)) { return 0; }
+   SearchPath before(maxLevel_);
+   findPredecessors(low, before);
+   SearchPath after = before;
+   fingerSearch(high, after);
+   return eraseBetween(before, after);
+}
+
+// Function purpose: To move every item of another SkipList into this one
+// Parameters: An rvalue SkipList
+// Preconditions: Both SkipLists have the same ordering
+// Postconditions: This SkipList holds the union of both, the parameter is empty, and the nodes of both 
+// have been relinked rather than copied unless the allocators cannot free each other's nodes; items of the
+// parameter already in this SkipList are released. This SkipList keeps its allocator, which relinked nodes 
+// of the parameter share
+// Return value: int for the number of items added
+// Functions called: growLevels, detachAll, appendLinked, destroyNode, spliceMerged, growIfNeeded
+template<class T, class Compare, class Allocator, bool Indexed>
+int SkipList<T, Compare, Allocator, Indexed>::merge(SkipList<T, Compare, Allocator, Indexed>&& other) {
+   if (&other == this) { return 0; }
+   int before = size_;
+   if (nodeAlloc_ != other.nodeAlloc_) {
+      // The nodes of other cannot be released through this allocator, so its items are copied instead
+      spliceMerged(other, SetOperation::UNION);
+      other.clear();
+      return size_ - before;
+   }
+   if (other.maxLevel_ > maxLevel_) { growLevels(other.maxLevel_); }
+   SkipListNode *mine = detachAll();
+   SkipListNode *theirs = other.detachAll();
+   while (mine != nullptr || theirs != nullptr) {
+      SkipListNode *taken;
+      if (theirs == nullptr || (mine != nullptr && comp_(mine->data_, theirs->data_))) {
+         taken = mine;
+         mine = mine->next(0);
+      }
+      else if (mine == nullptr || comp_(theirs->data_, mine->data_)) {
+         taken = theirs;
+         theirs = theirs->next(0);
+      }
+      else {
+         // Equal items: the node of this SkipList is kept
+         taken = mine;
+         mine = mine->next(0);
+         SkipListNode *duplicate = theirs;
+         theirs = theirs->next(0);
+         destroyNode(duplicate);
+      }
+      appendLinked(taken);
+   }
+   growIfNeeded();
+   return size_ - before;
+}
+
+// Function purpose: To return the items that are in this SkipList or another
+// Parameters: A SkipList
+// Preconditions: Both SkipLists have the same ordering
+// Postconditions: The result uses the allocator a copy of this SkipList would get
+// Return value: SkipList holding the union, with the node heights of the items it was built from
+// Functions called: appendMerged
+template<class T, class Compare, class Allocator, bool Indexed>
+SkipList<T, Compare, Allocator, Indexed> SkipList<T, Compare, Allocator, Indexed>::set_union(const SkipList<T, Compare, Allocator, Indexed>& other) const & {
+   // Every item kept is copied, so the result gets its own allocator, as a copy of this SkipList would
+   SkipList result(1, comp_, Allocator(NodeTraits::select_on_container_copy_construction(nodeAlloc_)));
+   result.levelGenerator_ = levelGenerator_;
+   result.appendMerged(*this, other, SetOperation::UNION);
+   return result;
+}
+
+// Function purpose: To return the items that are in this SkipList or another, reusing the nodes of this one
+// Parameters: A SkipList
+// Preconditions: Both SkipLists have the same ordering
+// Postconditions: This SkipList is left empty; the nodes are relinked, so the result keeps 
+// sharing the allocator of this SkipList
+// Return value: SkipList holding the union
+// Functions called: spliceMerged
+template<class T, class Compare, class Allocator, bool Indexed>
+SkipList<T, Compare, Allocator, Indexed> SkipList<T, Compare, Allocator, Indexed>::set_union(const SkipList<T, Compare, Allocator, Indexed>& other) && {
+   spliceMerged(other, SetOperation::UNION);
+   return std::move(*this);
+}
+
+// Function purpose: To return the items that are in this SkipList or another, reusing the nodes of both
+// Parameters: An rvalue SkipList
+// Preconditions: Both SkipLists have the same ordering
+// Postconditions: This SkipList and the parameter are left empty; the nodes are relinked, so the result keeps 
+// sharing the allocator of this SkipList
+// Return value: SkipList holding the union
+// Functions called: merge
+template<class T, class Compare, class Allocator, bool Indexed>
+SkipList<T, Compare, Allocator, Indexed> SkipList<T, Compare, Allocator, Indexed>::set_union(SkipList<T, Compare, Allocator, Indexed>&& other) && {
+   merge(std::move(other));
+   return std::move(*this);
+}
+
+// Function purpose: To return the items that are in both this SkipList and another
+// Parameters: A SkipList
+// Preconditions: Both SkipLists have the same ordering
+// Postconditions: The result uses the allocator a copy of this SkipList would get
+// Return value: SkipList holding the intersection, with the node heights of this SkipList
+// Functions called: appendMerged
+template<class T, class Compare, class Allocator, bool Indexed>
+SkipList<T, Compare, Allocator, Indexed> SkipList<T, Compare, Allocator, Indexed>::set_intersection(const SkipList<T, Compare, Allocator, Indexed>& other) const & {
+   // Every item kept is copied, so the result gets its own allocator, as a copy of this SkipList would
+   SkipList result(1, comp_, Allocator(NodeTraits::select_on_container_copy_construction(nodeAlloc_)));
+   result.levelGenerator_ = levelGenerator_;
+   result.appendMerged(*this, other, SetOperation::INTERSECTION);
+   return result;
+}
+
+// Function purpose: To return the items that are in both this SkipList and another, reusing the nodes of 
+// this one
+// Parameters: A SkipList
+// Preconditions: Both SkipLists have the same ordering
+// Postconditions: This SkipList is left empty; the nodes are relinked, so the result keeps 
+// sharing the allocator of this SkipList
+// Return value: SkipList holding the intersection
+// Functions called: spliceMerged
+template<class T, class Compare, class Allocator, bool Indexed>
+SkipList<T, Compare, Allocator, Indexed> SkipList<T, Compare, Allocator, Indexed>::set_intersection(const SkipList<T, Compare, Allocator, Indexed>& other) && {
+   spliceMerged(other, SetOperation::INTERSECTION);
+   return std::move(*this);
+}
+
+// Function purpose: To return the items of this SkipList that are not in another
+// Parameters: A SkipList
+// Preconditions: Both SkipLists have the same ordering
+// Postconditions: The result uses the allocator a copy of this SkipList would get
+// Return value: SkipList holding the difference, with the node heights of this SkipList
+// Functions called: appendMerged
+template<class T, class Compare, class Allocator, bool Indexed>
+SkipList<T, Compare, Allocator, Indexed> SkipList<T, Compare, Allocator, Indexed>::set_difference(const SkipList<T, Compare, Allocator, Indexed>& other) const & {
+   // Every item kept is copied, so the result gets its own allocator, as a copy of this SkipList would
+   SkipList result(1, comp_, Allocator(NodeTraits::select_on_container_copy_construction(nodeAlloc_)));
+   result.levelGenerator_ = levelGenerator_;
+   result.appendMerged(*this, other, SetOperation::DIFFERENCE);
+   return result;
+}
+
+// Function purpose: To return the items of this SkipList that are not in another, reusing the nodes of 
+// this one
+// Parameters: A SkipList
+// Preconditions: Both SkipLists have the same ordering
+// Postconditions: This SkipList is left empty; the nodes are relinked, so the result keeps 
+// sharing the allocator of this SkipList
+// Return value: SkipList holding the difference
+// Functions called: spliceMerged
+template<class T, class Compare, class Allocator, bool Indexed>
+SkipList<T, Compare, Allocator, Indexed> SkipList<T, Compare, Allocator, Indexed>::set_difference(const SkipList<T, Compare, Allocator, Indexed>& other) && {
+   spliceMerged(other, SetOperation::DIFFERENCE);
+   return std::move(*this);
+}
+
+// Function purpose: To move every item that is not less than a key into a new SkipList
+// Parameters: The key at which to split
+// Preconditions: Initialized SkipList
+// Postconditions: This SkipList holds the items less than key; no node is copied or reallocated, so the 
+// result shares the allocator of this SkipList
+// Return value: SkipList holding the items not less than key, with the same node heights
+// Functions called: findPredecessors, successor, linkWidth
+template<class T, class Compare, class Allocator, bool Indexed>
+SkipList<T, Compare, Allocator, Indexed> SkipList<T, Compare, Allocator, Indexed>::split(const T& key) {
+   SkipList result(maxLevel_, comp_, get_allocator());
+   result.levelGenerator_ = levelGenerator_;
+   SearchPath before(maxLevel_);
+   SkipListNode *first = findPredecessors(key, before);
+   if (first == nullptr) { return result; }
+
+   // An Indexed SkipList knows the position of the boundary. Otherwise the items are counted by walking 
+   // away from the boundary in both directions until either end is reached, which takes as many steps as 
+   // the smaller of the two parts.
+   int kept;
+   if (Indexed) {
+      kept = before.ranks_[0];
    }
    else {
-      int currentIndex = maxLevel_ - 1;
-      SkipListNode *curr = heads_[currentIndex];
-      vector <SkipListNode*> locations(maxLevel_);
-      
-      while (curr == nullptr || curr->data_ > data) {
-         currentIndex--;
-         curr = heads_[currentIndex];
-      }
-      for (int i = currentIndex; i >= 0; i--) {
-         while (curr->next_ != nullptr && curr->next_->data_ <= data) { 
-            curr = curr->next_; 
-         }
-         if (curr->data_ == data) { locations[i] = (curr); }
-         if (i > 0) { curr = curr->downLevel_; }
+      const SkipListNode *left = before.nodes_[0];
+      const SkipListNode *right = first;
+      int steps = 0;
+      while (left != nullptr && right != nullptr) {
+         left = left->prev_;
+         right = right->next(0);
+         steps++;
       }
+      kept = (left == nullptr) ? steps : size_ - steps;
+   }
+   int moved = size_ - kept;
 
-      for (int i = locations.size() - 1; i >= 0; i--) {
-         if (locations[i] != nullptr) {
-            SkipListNode *toDelete = locations[i];
-            if (toDelete->next_ == nullptr && toDelete->prev_ == nullptr) {
-               heads_[i] = nullptr;
-               tails_[i] = nullptr;   
-            }
-            else if (toDelete->next_ == nullptr) {
-               SkipListNode *endNode = toDelete->prev_;
-               endNode->next_ = nullptr;
-               tails_[i] = endNode;
-            }
-            else if (toDelete->prev_ == nullptr) {
-               SkipListNode *firstNode = toDelete->next_;
-               firstNode->prev_ = nullptr;
-               heads_[i] = firstNode;
-            }
-            else {
-               SkipListNode *previous = toDelete->prev_;
-               addBefore(previous, toDelete->next_);
-            }
-            delete toDelete;
-            toDelete = nullptr;
-         }
+   // Every level is cut after the last node that is less than key
+   for (int i = 0; i < maxLevel_; i++) {
+      SkipListNode *pred = before.nodes_[i];
+      SkipListNode *head = successor(pred, i);
+      if (Indexed) {
+         result.headWidths_[i] = (head == nullptr) ? moved + 1 : before.ranks_[i] + linkWidth(pred, i) - kept;
+         linkWidth(pred, i) = kept + 1 - before.ranks_[i];
       }
-      size_ -= 1;
+      result.heads_[i] = head;
+      result.tails_[i] = (head == nullptr) ? nullptr : tails_[i];
+      if (pred == nullptr) { heads_[i] = nullptr; }
+      else { pred->next(i) = nullptr; }
+      tails_[i] = pred;
+   }
+   first->prev_ = nullptr;
+   size_ = kept;
+   result.size_ = moved;
+   return result;
+}
+
+// Function purpose: To check the structure of the SkipList
+// Parameters: N/A
+// Preconditions: Initialized SkipList
+// Postconditions: N/A
+// Return value: bool that is true if every level is strictly increasing and a subsequence of the level 
+// below, heads_, tails_, prev_ and size_ agree with the links and, if Indexed, every width is correct
+// Functions called: checkStructure
+template<class T, class Compare, class Allocator, bool Indexed>
+bool SkipList<T, Compare, Allocator, Indexed>::validate() const {
+   return checkStructure(false);
+}
+
+// Function purpose: To check the structure of the SkipList, with or without equal items
+// Parameters: A bool that is true if equal items may follow each other
+// Preconditions: Initialized SkipList
+// Postconditions: N/A
+// Return value: bool that is true if every level is increasing (non-decreasing if allowEqual) and a 
+// subsequence of the level below, heads_, tails_, prev_ and size_ agree with the links and, if Indexed, 
+// every width is correct
+// Functions called: linkWidth
+template<class T, class Compare, class Allocator, bool Indexed>
+bool SkipList<T, Compare, Allocator, Indexed>::checkStructure(bool allowEqual) const {
+   // The lowest level holds every item in increasing order, linked back through prev_
+   int count = 0;
+   SkipListNode *last = nullptr;
+   for (SkipListNode *curr = heads_[0]; curr != nullptr; curr = curr->next(0)) {
+      if (curr->prev_ != last || curr->height_ < 1 || curr->height_ > maxLevel_) { return false; }
+      if (last != nullptr && (allowEqual ? comp_(curr->data_, last->data_) : !comp_(last->data_, curr->data_))) { 
+         return false; 
+      }
+      last = curr;
+      count++;
+   }
+   if (count != size_ || tails_[0] != last) { return false; }
+
+   // Every other level must link exactly the nodes of the lowest level that are tall enough, in the same 
+   // order, so each level is checked against one walk of the lowest level, which also gives the positions 
+   // that the widths must span
+   for (int i = 0; i < maxLevel_; i++) {
+      SkipListNode *expected = heads_[i];
+      SkipListNode *pred = nullptr;
+      int predPosition = 0;
+      int position = 0;
+      for (SkipListNode *curr = heads_[0]; curr != nullptr; curr = curr->next(0)) {
+         position++;
+         if (curr->height_ <= i) { continue; }
+         if (curr != expected) { return false; }
+         if (Indexed && linkWidth(pred, i) != position - predPosition) { return false; }
+         pred = curr;
+         predPosition = position;
+         expected = curr->next(i);
+      }
+      if (expected != nullptr || tails_[i] != pred) { return false; }
+      if (Indexed && linkWidth(pred, i) != size_ + 1 - predPosition) { return false; }
+   }
+   return true;
+}
+
+#ifdef SKIPLIST_STATS
+// Function purpose: To return the mean number of comparisons or hops per operation
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: double; 0 if no operation has been counted
+// Functions called: N/A
+template<class T, class Compare, class Allocator, bool Indexed>
+double SkipList<T, Compare, Allocator, Indexed>::OperationStats::averageComparisons() const {
+   return (count == 0) ? 0.0 : static_cast<double>(comparisons) / count;
+}
+
+template<class T, class Compare, class Allocator, bool Indexed>
+double SkipList<T, Compare, Allocator, Indexed>::OperationStats::averageHops() const {
+   return (count == 0) ? 0.0 : static_cast<double>(hops) / count;
+}
+
+// Function purpose: To report the shape of the SkipList and the work done by its operations
+// Parameters: N/A
+// Preconditions: Initialized SkipList
+// Postconditions: N/A
+// Return value: Stats
+// Functions called: nodeSlots
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::Stats SkipList<T, Compare, Allocator, Indexed>::stats() const {
+   Stats result;
+   result.levelCounts.assign(maxLevel_, 0);
+   result.nodeBytes = 0;
+   for (SkipListNode *curr = heads_[0]; curr != nullptr; curr = curr->next(0)) {
+      for (int i = 0; i < curr->height_; i++) { result.levelCounts[i]++; }
+      result.nodeBytes += nodeSlots(curr->height_) * sizeof(NodeSlot);
    }
-   return containsValue;
+   result.contains = containsStats_;
+   result.insert = insertStats_;
+   result.erase = eraseStats_;
+   result.allocatedNodeBytes = allocatedNodeBytes_;
+   return result;
+}
+
+// Function purpose: To reset the operation and allocation counters
+// Parameters: N/A
+// Preconditions: Initialized SkipList
+// Postconditions: Every counter reported by stats() except levelCounts and nodeBytes is zero
+// Return value: void
+// Functions called: N/A
+template<class T, class Compare, class Allocator, bool Indexed>
+void SkipList<T, Compare, Allocator, Indexed>::reset_stats() {
+   containsStats_ = OperationStats();
+   insertStats_ = OperationStats();
+   eraseStats_ = OperationStats();
+   allocatedNodeBytes_ = 0;
 }
+#endif
 
+// Function purpose: To count the work of a search when SKIPLIST_STATS is defined; does nothing otherwise
+// Parameters: The number of items compared against and the number of links followed
+// Preconditions: N/A
+// Postconditions: The counters of the search in progress have grown
+// Return value: void
+// Functions called: N/A
+template<class T, class Compare, class Allocator, bool Indexed>
+void SkipList<T, Compare, Allocator, Indexed>::countSearch(int comparisons, int hops) const {
+#ifdef SKIPLIST_STATS
+   searchComparisons_ += comparisons;
+   searchHops_ += hops;
+#else
+   (void)comparisons;
+   (void)hops;
+#endif
+}
+
+// Function purpose: To start counting the search of an operation when SKIPLIST_STATS is defined
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: The counters of the search in progress are zero
+// Return value: void
+// Functions called: N/A
+template<class T, class Compare, class Allocator, bool Indexed>
+void SkipList<T, Compare, Allocator, Indexed>::beginSearch() const {
+#ifdef SKIPLIST_STATS
+   searchComparisons_ = 0;
+   searchHops_ = 0;
+#endif
+}
+
+// Function purpose: To add the search in progress to the stats of an operation when SKIPLIST_STATS is 
+// defined
+// Parameters: The operation that made the search
+// Preconditions: beginSearch was called before the search
+// Postconditions: The operation has been counted
+// Return value: void
+// Functions called: N/A
+template<class T, class Compare, class Allocator, bool Indexed>
+void SkipList<T, Compare, Allocator, Indexed>::finishSearch(StatsOperation operation) const {
+#ifdef SKIPLIST_STATS
+   OperationStats &stats = (operation == StatsOperation::CONTAINS) ? containsStats_ 
+      : (operation == StatsOperation::INSERT) ? insertStats_ : eraseStats_;
+   stats.count++;
+   stats.comparisons += searchComparisons_;
+   stats.hops += searchHops_;
+   stats.maxComparisons = max(stats.maxComparisons, searchComparisons_);
+   stats.maxHops = max(stats.maxHops, searchHops_);
+#else
+   (void)operation;
+#endif
+}
 
 // Function purpose: To return the number of items in the base level of the SkipList
 // Parameters: N/A
@@ -553,38 +1666,446 @@ bool SkipList<T>::erase(T data) {
 // Postconditions: An integer representing the amount of items in the SkipList
 // Return value: int
 // Functions called: N/A
-template<class T>
-int SkipList<T>::size() const {
+template<class T, class Compare, class Allocator, bool Indexed>
+int SkipList<T, Compare, Allocator, Indexed>::size() const {
    return size_;
 }
 
 // Function purpose: To copy the items in one SkipList and add them to the current object
 // Parameters: An initialized SkipList
 // Preconditions: SkipList is empty
-// Postconditions: SkipList container the same items as the parameter  
+// Postconditions: SkipList container the same items as the parameter, with the same node heights
 // Return value: void
-// Functions called: N/A
-template<class T>
-void SkipList<T>::copyContents(const SkipList<T>& skip) {
+// Functions called: growLevels, appendNode
+template<class T, class Compare, class Allocator, bool Indexed>
+void SkipList<T, Compare, Allocator, Indexed>::copyContents(const SkipList<T, Compare, Allocator, Indexed>& skip) {
+   if (skip.maxLevel_ > maxLevel_) { growLevels(skip.maxLevel_); }
    const SkipListNode *curr = skip.heads_[0];
    while (curr != nullptr) {
-      insert(curr->data_);
-      curr = curr->next_;
+      appendNode(curr->data_, curr->height_);
+      curr = curr->next(0);
+   }
+}
+
+// Function purpose: To add a node after the last item of every level it occupies
+// Parameters: The item to store and the height of the new node
+// Preconditions: SkipList is empty or its last item is less than data; height <= maxLevel_
+// Postconditions: The item is the last item of the SkipList
+// Return value: SkipListNode pointer
+// Functions called: createNode, appendLinked
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::SkipListNode* SkipList<T, Compare, Allocator, Indexed>::appendNode(const T& data, int height) {
+   SkipListNode *newValue = createNode(height, data);
+   appendLinked(newValue);
+   return newValue;
+}
+
+// Function purpose: To add an allocated node after the last item of every level it occupies
+// Parameters: The SkipListNode pointer, which is not linked into any SkipList
+// Preconditions: SkipList is empty or its last item is less than the item of node; node->height_ <= 
+// maxLevel_; the node was allocated by an allocator equal to nodeAlloc_
+// Postconditions: The item is the last item of the SkipList
+// Return value: void
+// Functions called: insertAtLevel, linkWidth
+template<class T, class Compare, class Allocator, bool Indexed>
+void SkipList<T, Compare, Allocator, Indexed>::appendLinked(SkipListNode *node) {
+   int height = node->height_;
+   if (Indexed) {
+      // The links into the new last node keep their widths; the links that pass over it grow by one
+      for (int i = 0; i < maxLevel_; i++) {
+         if (i < height) { node->width(i) = 1; }
+         else { linkWidth(tails_[i], i) += 1; }
+      }
+   }
+   for (int i = 0; i < height; i++) {
+      insertAtLevel(node, tails_[i], i);
+   }
+   size_ += 1;
+}
+
+// Function purpose: To empty the SkipList without releasing its nodes
+// Parameters: N/A
+// Preconditions: Initialized SkipList
+// Postconditions: The SkipList is empty; the former nodes are still chained on the lowest level
+// Return value: The former first node, or nullptr
+// Functions called: N/A
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::SkipListNode* SkipList<T, Compare, Allocator, Indexed>::detachAll() {
+   SkipListNode *first = heads_[0];
+   for (int i = 0; i < maxLevel_; i++) {
+      heads_[i] = nullptr;
+      tails_[i] = nullptr;
+      if (Indexed) { headWidths_[i] = 1; }
+   }
+   size_ = 0;
+   return first;
+}
+
+// Function purpose: To append the result of a set operation on two SkipLists, copying the items kept
+// Parameters: The two SkipLists and the operation
+// Preconditions: This SkipList is empty and is neither parameter
+// Postconditions: This SkipList holds the result, with the node heights of the items it was built from
+// Return value: void
+// Functions called: growLevels, appendNode, growIfNeeded
+template<class T, class Compare, class Allocator, bool Indexed>
+void SkipList<T, Compare, Allocator, Indexed>::appendMerged(const SkipList<T, Compare, Allocator, Indexed>& first, 
+      const SkipList<T, Compare, Allocator, Indexed>& second, SetOperation operation) {
+   int levels = max(first.maxLevel_, second.maxLevel_);
+   if (levels > maxLevel_) { growLevels(levels); }
+   const SkipListNode *mine = first.heads_[0];
+   const SkipListNode *theirs = second.heads_[0];
+   while (mine != nullptr) {
+      while (theirs != nullptr && comp_(theirs->data_, mine->data_)) {
+         if (operation == SetOperation::UNION) { appendNode(theirs->data_, theirs->height_); }
+         theirs = theirs->next(0);
+      }
+      if (theirs == nullptr && operation == SetOperation::INTERSECTION) { break; }
+      bool shared = (theirs != nullptr && !comp_(mine->data_, theirs->data_));
+      if (shared) { theirs = theirs->next(0); }
+      if (operation == SetOperation::UNION || (operation == SetOperation::INTERSECTION) == shared) {
+         appendNode(mine->data_, mine->height_);
+      }
+      mine = mine->next(0);
+   }
+   if (operation == SetOperation::UNION) {
+      for (; theirs != nullptr; theirs = theirs->next(0)) {
+         appendNode(theirs->data_, theirs->height_);
+      }
+   }
+   growIfNeeded();
+}
+
+// Function purpose: To replace the contents with the result of a set operation with another SkipList, 
+// relinking the nodes of this SkipList that are kept
+// Parameters: The other SkipList and the operation
+// Preconditions: Initialized SkipLists
+// Postconditions: This SkipList holds the result; its dropped nodes have been released
+// Return value: void
+// Functions called: clear, growLevels, detachAll, appendLinked, appendNode, destroyNode, growIfNeeded
+template<class T, class Compare, class Allocator, bool Indexed>
+void SkipList<T, Compare, Allocator, Indexed>::spliceMerged(const SkipList<T, Compare, Allocator, Indexed>& other, 
+      SetOperation operation) {
+   if (&other == this) {
+      // A SkipList is its own union and intersection, and its difference with itself is empty
+      if (operation == SetOperation::DIFFERENCE) { clear(); }
+      return;
+   }
+   if (operation == SetOperation::UNION && other.maxLevel_ > maxLevel_) { growLevels(other.maxLevel_); }
+   const SkipListNode *theirs = other.heads_[0];
+   SkipListNode *mine = detachAll();
+   try {
+      while (mine != nullptr) {
+         while (theirs != nullptr && comp_(theirs->data_, mine->data_)) {
+            if (operation == SetOperation::UNION) { appendNode(theirs->data_, theirs->height_); }
+            theirs = theirs->next(0);
+         }
+         bool shared = (theirs != nullptr && !comp_(mine->data_, theirs->data_));
+         if (shared) { theirs = theirs->next(0); }
+         SkipListNode *next = mine->next(0);
+         if (operation == SetOperation::UNION || (operation == SetOperation::INTERSECTION) == shared) {
+            appendLinked(mine);
+         }
+         else {
+            destroyNode(mine);
+         }
+         mine = next;
+      }
+      if (operation == SetOperation::UNION) {
+         for (; theirs != nullptr; theirs = theirs->next(0)) {
+            appendNode(theirs->data_, theirs->height_);
+         }
+      }
+   }
+   catch (...) {
+      // The nodes that were not relinked yet are released, leaving the items appended so far
+      while (mine != nullptr) {
+         SkipListNode *next = mine->next(0);
+         destroyNode(mine);
+         mine = next;
+      }
+      throw;
+   }
+   growIfNeeded();
+}
+
+// Function purpose: To add a range of items, appending in one pass while the range is increasing
+// Parameters: Input iterators to the first and past the last item
+// Preconditions: Initialized SkipList
+// Postconditions: Every item of the range is in the SkipList
+// Return value: void
+// Functions called: appendNode, randomHeight, growIfNeeded, insert
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class InputIt>
+void SkipList<T, Compare, Allocator, Indexed>::appendRange(InputIt first, InputIt last) {
+   for (; first != last; ++first) {
+      const T &data = *first;
+      if (size_ == 0 || comp_(tails_[0]->data_, data)) {
+         appendNode(data, randomHeight());
+         growIfNeeded();
+      }
+      else {
+         insert(data);
+      }
+   }
+}
+
+// Function purpose: To add a range of items, resuming each search from the predecessors of the last one
+// Parameters: Input iterators to the first and past the last item
+// Preconditions: Initialized SkipList
+// Postconditions: Every item of the range is in the SkipList; items that were already there are skipped
+// Return value: int for the number of items inserted
+// Functions called: fingerSearch, randomHeight, createNode, linkNode
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class InputIt>
+int SkipList<T, Compare, Allocator, Indexed>::insert_range(InputIt first, InputIt last) {
+   // Sized for MAX_LEVEL so that levels added while the range is inserted start out at their heads
+   SearchPath finger(MAX_LEVEL);
+   int inserted = 0;
+   for (; first != last; ++first) {
+      const T &data = *first;
+      SkipListNode *found = fingerSearch(data, finger);
+      if (found != nullptr && !comp_(data, found->data_)) { continue; }
+      SkipListNode *newValue = createNode(randomHeight(), data);
+      int position = Indexed ? finger.ranks_[0] + 1 : 0;
+      linkNode(newValue, finger);
+      // The new node is the closest predecessor of the next item of a sorted range on every level it occupies
+      for (int i = 0; i < newValue->height_; i++) {
+         finger.nodes_[i] = newValue;
+         if (Indexed) { finger.ranks_[i] = position; }
+      }
+      inserted++;
+   }
+   return inserted;
+}
+
+// Function purpose: To remove a range of items, resuming each search from the predecessors of the last one
+// Parameters: Input iterators to the first and past the last item
+// Preconditions: Initialized SkipList
+// Postconditions: No item of the range is in the SkipList
+// Return value: int for the number of items removed
+// Functions called: fingerSearch, unlinkNode
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class InputIt>
+int SkipList<T, Compare, Allocator, Indexed>::erase_range(InputIt first, InputIt last) {
+   SearchPath finger(maxLevel_);
+   int removed = 0;
+   for (; first != last; ++first) {
+      const T &data = *first;
+      SkipListNode *found = fingerSearch(data, finger);
+      if (found == nullptr || comp_(data, found->data_)) { continue; }
+      // The predecessors stay before the next item, so the finger remains valid after the unlink
+      unlinkNode(found, finger);
+      removed++;
+   }
+   return removed;
+}
+
+// Function purpose: To replace the contents of the SkipList with a sorted range of unique items
+// Parameters: Input iterators to the first and past the last item
+// Preconditions: The range is strictly increasing; items out of order are inserted one by one
+// Postconditions: The SkipList holds exactly the items of the range
+// Return value: void
+// Functions called: clear, appendRange
+template<class T, class Compare, class Allocator, bool Indexed>
+template<class InputIt>
+void SkipList<T, Compare, Allocator, Indexed>::assign_sorted(InputIt first, InputIt last) {
+   clear();
+   appendRange(first, last);
+}
+
+// Function purpose: To write or read raw bytes of a snapshot
+// Parameters: The stream, the bytes and their number
+// Preconditions: N/A
+// Postconditions: The bytes have been written or read
+// Return value: void; throws runtime_error if the stream fails
+// Functions called: N/A
+template<class T, class Compare, class Allocator, bool Indexed>
+void SkipList<T, Compare, Allocator, Indexed>::writeBytes(ostream& out, const void *bytes, size_t length) {
+   out.write(static_cast<const char*>(bytes), static_cast<streamsize>(length));
+   if (!out) { throw runtime_error("SkipList::save: write failed"); }
+}
+
+template<class T, class Compare, class Allocator, bool Indexed>
+void SkipList<T, Compare, Allocator, Indexed>::readBytes(istream& in, void *bytes, size_t length) {
+   in.read(static_cast<char*>(bytes), static_cast<streamsize>(length));
+   if (!in) { throw runtime_error("SkipList::load: snapshot is truncated"); }
+}
+
+// Function purpose: To write the SkipList to a binary snapshot
+// Parameters: The output stream and whether the levels above the lowest are stored
+// Preconditions: T is trivially copyable but not a pointer, or string
+// Postconditions: The snapshot described in SkipListSnapshot.h has been written to out
+// Return value: void; throws runtime_error if the stream fails
+// Functions called: SkipListSnapshot::makeHeader, writeBytes
+template<class T, class Compare, class Allocator, bool Indexed>
+void SkipList<T, Compare, Allocator, Indexed>::save(ostream& out, bool towers) const {
+   static_assert(SkipListSnapshot::supports<T>(), "save requires trivially copyable items other than pointers, or strings");
+   const uint64_t zeros = 0;
+   uint64_t count = static_cast<uint64_t>(size_);
+   uint32_t levels = 1;
+   if (towers) {
+      while (levels < static_cast<uint32_t>(maxLevel_) && heads_[levels] != nullptr) { levels++; }
+   }
+
+   uint64_t dataBytes = 0;
+   if constexpr (is_same<T, string>::value) {
+      for (const SkipListNode *curr = heads_[0]; curr != nullptr; curr = curr->next(0)) {
+         dataBytes += curr->data_.size();
+      }
+      dataBytes = SkipListSnapshot::padded(dataBytes) + (count + 1) * sizeof(uint64_t);
+   }
+   else {
+      dataBytes = SkipListSnapshot::padded(count * sizeof(T));
+   }
+   SkipListSnapshot::Header header = SkipListSnapshot::makeHeader<T>(count, dataBytes, levels);
+   writeBytes(out, &header, sizeof(header));
+
+   uint64_t written = 0;
+   if constexpr (is_same<T, string>::value) {
+      uint64_t offset = 0;
+      writeBytes(out, &offset, sizeof(offset));
+      for (const SkipListNode *curr = heads_[0]; curr != nullptr; curr = curr->next(0)) {
+         offset += curr->data_.size();
+         writeBytes(out, &offset, sizeof(offset));
+      }
+      for (const SkipListNode *curr = heads_[0]; curr != nullptr; curr = curr->next(0)) {
+         writeBytes(out, curr->data_.data(), curr->data_.size());
+      }
+      written = (count + 1) * sizeof(uint64_t) + offset;
+   }
+   else {
+      for (const SkipListNode *curr = heads_[0]; curr != nullptr; curr = curr->next(0)) {
+         writeBytes(out, &curr->data_, sizeof(T));
+      }
+      written = count * sizeof(T);
+   }
+   writeBytes(out, &zeros, dataBytes - written);
+
+   if (levels > 1) {
+      // One walk of the lowest level numbers every node on each level it occupies
+      vector<vector<SkipListSnapshot::Link>> links(levels);
+      uint64_t index = 0;
+      for (const SkipListNode *curr = heads_[0]; curr != nullptr; curr = curr->next(0), index++) {
+         int top = (curr->height_ < static_cast<int>(levels)) ? curr->height_ : static_cast<int>(levels);
+         for (int i = 1; i < top; i++) {
+            uint64_t down = (i == 1) ? index : links[i - 1].size() - 1;
+            links[i].push_back({index, down});
+         }
+      }
+      for (uint32_t i = 1; i < levels; i++) {
+         uint64_t length = links[i].size();
+         writeBytes(out, &length, sizeof(length));
+         writeBytes(out, links[i].data(), length * sizeof(SkipListSnapshot::Link));
+      }
    }
 }
 
+// Function purpose: To replace the contents of the SkipList with a binary snapshot
+// Parameters: The input stream
+// Preconditions: T is trivially copyable but not a pointer, or string
+// Postconditions: The SkipList holds the saved items, with the saved heights if towers were stored
+// Return value: void; throws runtime_error if the snapshot is invalid, leaving the SkipList unchanged
+// Functions called: SkipListSnapshot::checkHeader, readBytes, clear, growLevels, appendNode, appendRange
+template<class T, class Compare, class Allocator, bool Indexed>
+void SkipList<T, Compare, Allocator, Indexed>::load(istream& in) {
+   static_assert(SkipListSnapshot::supports<T>(), "load requires trivially copyable items other than pointers, or strings");
+   SkipListSnapshot::Header header;
+   readBytes(in, &header, sizeof(header));
+   SkipListSnapshot::checkHeader<T>(header, "SkipList::load");
+   if (header.count > static_cast<uint64_t>(numeric_limits<int>::max())) {
+      throw runtime_error("SkipList::load: snapshot holds too many items");
+   }
+   size_t count = static_cast<size_t>(header.count);
+   // Nothing is allocated from count until the item section is known to be large enough to hold that many
+   uint64_t itemSize = is_same<T, string>::value ? sizeof(uint64_t) : sizeof(T);
+   if (count + (is_same<T, string>::value ? 1 : 0) > header.itemBytes / itemSize) {
+      throw runtime_error("SkipList::load: corrupt item section");
+   }
+
+   // The whole snapshot is read and checked before the current contents are touched. items is not reserved 
+   // up front, so it only grows as far as the stream really holds items.
+   vector<T> items;
+   uint64_t consumed = 0;
+   if constexpr (is_same<T, string>::value) {
+      vector<uint64_t> offsets(count + 1);
+      readBytes(in, offsets.data(), offsets.size() * sizeof(uint64_t));
+      consumed = offsets.size() * sizeof(uint64_t);
+      // The characters are read one string after another, which is only where MappedSkipList finds them if 
+      // the first string starts at offset 0
+      if (offsets[0] != 0) { throw runtime_error("SkipList::load: corrupt string offsets"); }
+      for (size_t i = 0; i < count; i++) {
+         if (offsets[i + 1] < offsets[i] || consumed + offsets[i + 1] > header.itemBytes) {
+            throw runtime_error("SkipList::load: corrupt string offsets");
+         }
+         string item(offsets[i + 1] - offsets[i], '\0');
+         readBytes(in, &item[0], item.size());
+         items.push_back(std::move(item));
+      }
+      consumed += offsets[count];
+   }
+   else {
+      // T need not be default constructible, so each record is read into raw storage and copied from there
+      alignas(T) unsigned char storage[sizeof(T)];
+      for (size_t i = 0; i < count; i++) {
+         readBytes(in, storage, sizeof(T));
+         items.push_back(*std::launder(reinterpret_cast<const T*>(storage)));
+      }
+      consumed = count * sizeof(T);
+   }
+   if (consumed > header.itemBytes) { throw runtime_error("SkipList::load: corrupt item section"); }
+   in.ignore(static_cast<streamsize>(header.itemBytes - consumed));
+   for (size_t i = 1; i < count; i++) {
+      if (!comp_(items[i - 1], items[i])) { throw runtime_error("SkipList::load: items are not in increasing order"); }
+   }
+
+   // A node is as tall as the highest level that links it
+   vector<unsigned char> heights(header.levels > 1 ? count : 0, 1);
+   for (uint32_t i = 1; i < header.levels; i++) {
+      uint64_t length;
+      readBytes(in, &length, sizeof(length));
+      if (length > count) { throw runtime_error("SkipList::load: corrupt level"); }
+      vector<SkipListSnapshot::Link> links(static_cast<size_t>(length));
+      readBytes(in, links.data(), links.size() * sizeof(SkipListSnapshot::Link));
+      for (const SkipListSnapshot::Link &link : links) {
+         if (link.item >= count) { throw runtime_error("SkipList::load: corrupt level"); }
+         heights[link.item] = static_cast<unsigned char>(i + 1);
+      }
+   }
+
+   clear();
+   if (header.levels == 1) {
+      appendRange(items.begin(), items.end());
+      return;
+   }
+   if (static_cast<int>(header.levels) > maxLevel_) { growLevels(static_cast<int>(header.levels)); }
+   for (size_t i = 0; i < count; i++) {
+      appendNode(items[i], heights[i]);
+   }
+   growIfNeeded();
+}
+
 // Function purpose: To remove the contents of a SkipList
 // Parameters: N/A
 // Preconditions: Initialized SkipList
-// Postconditions: Empty SkipList
+// Postconditions: Empty SkipList; every node has been released in a single pass over the lowest level
 // Return value: N/A
-// Functions called: empty(), erase
-template<class T>
-void SkipList<T>::clear() {
+// Functions called: destroyNode
+template<class T, class Compare, class Allocator, bool Indexed>
+void SkipList<T, Compare, Allocator, Indexed>::clear() {
    if (heads_ != nullptr && tails_ != nullptr) {
-      while (!empty()) {
-         erase(heads_[0]->data_);
+      // Every node is on the lowest level, so one sweep releases them all without searching
+      SkipListNode *curr = heads_[0];
+      while (curr != nullptr) {
+         SkipListNode *next = curr->next(0);
+         destroyNode(curr);
+         curr = next;
       }
+      for (int i = 0; i < maxLevel_; i++) {
+         heads_[i] = nullptr;
+         tails_[i] = nullptr;
+         if (Indexed) { headWidths_[i] = 1; }
+      }
+      size_ = 0;
    }
 }
 
@@ -594,17 +2115,9 @@ void SkipList<T>::clear() {
 // Postconditions: A bool reflecting whether SkipList is empty
 // Return value: bool
 // Functions called: N/A
-template<class T>
-bool SkipList<T>::empty() const {
-   bool isEmpty = true;
-   for (int i = 0; i < maxLevel_; i++) {
-      const SkipListNode *curr = heads_[i];
-      if (curr != nullptr) { 
-         isEmpty = false;
-         return isEmpty; 
-      }
-   }
-   return isEmpty;
+template<class T, class Compare, class Allocator, bool Indexed>
+bool SkipList<T, Compare, Allocator, Indexed>::empty() const {
+   return size_ == 0;
 }
 
 // Function purpose: To return an iterator set to the beginning of the lowest level of the SkipList
@@ -613,9 +2126,9 @@ bool SkipList<T>::empty() const {
 // Postconditions: An iterator at the beginning of the SkipList
 // Return value: iterator
 // Functions called: iterator()
-template<class T>
-typename SkipList<T>::iterator SkipList<T>::begin() const {
-   return iterator(const_cast<SkipList<T>*>(this), const_cast<SkipListNode*>(this->heads_[0]));
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::iterator SkipList<T, Compare, Allocator, Indexed>::begin() const {
+   return iterator(this, this->heads_[0]);
 }
 
 // Function purpose: To return an iterator set to the end of the lowest level of the SkipList
@@ -624,7 +2137,134 @@ typename SkipList<T>::iterator SkipList<T>::begin() const {
 // Postconditions: An iterator at the end of the SkipList
 // Return value: iterator
 // Functions called: iterator()
-template<class T>
-typename SkipList<T>::iterator SkipList<T>::end() const {
-   return iterator(const_cast<SkipList<T>*>(this), nullptr);
-}
\ No newline at end of file
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::iterator SkipList<T, Compare, Allocator, Indexed>::end() const {
+   return iterator(this, nullptr);
+}
+
+// Function purpose: To return reverse iterators set to the last item and before the first item of the 
+// lowest level of the SkipList
+// Parameters: N/A
+// Preconditions: Initialized SkipList
+// Postconditions: N/A
+// Return value: reverse_iterator
+// Functions called: end, begin
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::reverse_iterator SkipList<T, Compare, Allocator, Indexed>::rbegin() const {
+   return reverse_iterator(end());
+}
+
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::reverse_iterator SkipList<T, Compare, Allocator, Indexed>::rend() const {
+   return reverse_iterator(begin());
+}
+
+// Function purpose: To return the first item of the SkipList
+// Parameters: N/A
+// Preconditions: The SkipList is not empty
+// Postconditions: N/A
+// Return value: const reference to the smallest item
+// Functions called: N/A
+template<class T, class Compare, class Allocator, bool Indexed>
+const T& SkipList<T, Compare, Allocator, Indexed>::front() const {
+   return heads_[0]->data_;
+}
+
+// Function purpose: To return the last item of the SkipList
+// Parameters: N/A
+// Preconditions: The SkipList is not empty
+// Postconditions: N/A
+// Return value: const reference to the largest item
+// Functions called: N/A
+template<class T, class Compare, class Allocator, bool Indexed>
+const T& SkipList<T, Compare, Allocator, Indexed>::back() const {
+   return tails_[0]->data_;
+}
+
+// Function purpose: To return a copy of the allocator used by the SkipList
+// Parameters: N/A
+// Preconditions: Initialized SkipList
+// Postconditions: N/A
+// Return value: allocator_type
+// Functions called: N/A
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::allocator_type SkipList<T, Compare, Allocator, Indexed>::get_allocator() const {
+   return allocator_type(nodeAlloc_);
+}
+
+// Function purpose: To return a copy of the comparator used by the SkipList
+// Parameters: N/A
+// Preconditions: Initialized SkipList
+// Postconditions: N/A
+// Return value: key_compare
+// Functions called: N/A
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::key_compare SkipList<T, Compare, Allocator, Indexed>::key_comp() const {
+   return comp_;
+}
+
+// Function purpose: To count the items that are less than a given item
+// Parameters: An item to search for
+// Preconditions: Indexed is true
+// Postconditions: N/A
+// Return value: int for the 0-based position that data has or would have in the SkipList
+// Functions called: successor, linkWidth
+template<class T, class Compare, class Allocator, bool Indexed>
+int SkipList<T, Compare, Allocator, Indexed>::rank(const T& data) const {
+   static_assert(Indexed, "rank requires an IndexedSkipList");
+   SkipListNode *pred = nullptr;
+   int rank = 0;
+   for (int i = maxLevel_ - 1; i >= 0; i--) {
+      SkipListNode *curr = successor(pred, i);
+      while (curr != nullptr && comp_(curr->data_, data)) {
+         rank += linkWidth(pred, i);
+         pred = curr;
+         curr = curr->next(i);
+      }
+   }
+   return rank;
+}
+
+// Function purpose: To locate the item at a position
+// Parameters: A 0-based index
+// Preconditions: Indexed is true
+// Postconditions: N/A
+// Return value: iterator to the item, or end() if index is not less than size()
+// Functions called: findIndex
+template<class T, class Compare, class Allocator, bool Indexed>
+typename SkipList<T, Compare, Allocator, Indexed>::iterator SkipList<T, Compare, Allocator, Indexed>::nth(int index) const {
+   static_assert(Indexed, "nth requires an IndexedSkipList");
+   SkipListNode *node = (index >= 0 && index < size_) ? findIndex(index, nullptr) : nullptr;
+   return iterator(this, node);
+}
+
+// Function purpose: To access the item at a position
+// Parameters: A 0-based index
+// Preconditions: Indexed is true
+// Postconditions: N/A
+// Return value: const reference to the item; throws out_of_range if index is not less than size()
+// Functions called: findIndex
+template<class T, class Compare, class Allocator, bool Indexed>
+const T& SkipList<T, Compare, Allocator, Indexed>::at(int index) const {
+   static_assert(Indexed, "at requires an IndexedSkipList");
+   if (index < 0 || index >= size_) {
+      throw out_of_range("SkipList::at: index is out of range");
+   }
+   return findIndex(index, nullptr)->data_;
+}
+
+// Function purpose: To remove the item at a position
+// Parameters: A 0-based index
+// Preconditions: Indexed is true
+// Postconditions: The item that was at index is no longer in the SkipList
+// Return value: int for the number of items removed (0 if index is out of range, otherwise 1)
+// Functions called: findIndex, unlinkNode
+template<class T, class Compare, class Allocator, bool Indexed>
+int SkipList<T, Compare, Allocator, Indexed>::erase_at(int index) {
+   static_assert(Indexed, "erase_at requires an IndexedSkipList");
+   if (index < 0 || index >= size_) { return 0; }
+   SearchPath locations(maxLevel_);
+   SkipListNode *toDelete = findIndex(index, &locations);
+   unlinkNode(toDelete, locations);
+   return 1;
+}
@@ -4,29 +4,74 @@ Created by Martin Rudzis
 5/5/2021
 
 Input & output: Constructor accepts any number small enough to not cause an std::bad_alloc exception. 
-After initialization, insert, erase, and contains may be used with any data type. insert and contains 
-return true if the parameter was successfully inserted or erased. Contains returns true if the parameter 
-exists in the SkipList.
+After initialization, insert, erase, and contains may be used with any data type. insert returns a pair 
+holding an iterator to the item and a bool that is true if the parameter was inserted, erase returns the 
+number of items removed (0 or 1), and contains returns true if the parameter exists in the SkipList.
 Program use: 
 To use the program, include SkipList.h in the driver file. 
 Initialization: SkipList objectName(<number of levels>); OR SkipList objectName; (This uses the default 
-number of levels, which is equal to 1.) Use of initializer_list is also supported.
-Insertion: objectName.insert(type); Only unique values may be added to the SkipList
-Deletion: objectName.erase(type);
+number of levels, which is equal to 1.) Use of initializer_list and of an iterator range 
+(SkipList objectName(first, last);) is also supported. Items given in strictly increasing order are 
+appended in a single left-to-right pass; assign_sorted(first, last) replaces the contents the same way. The number of levels 
+given to the constructor is only the starting point: levels are added automatically as the SkipList 
+grows, up to MAX_LEVEL.
+Node memory is obtained from the optional Allocator template argument (std::allocator<T> by default), 
+rebound to the node type. PoolAllocator.h provides a pooled allocator that recycles erased nodes: 
+SkipList<type, less<type>, PoolAllocator<type>> objectName;
+Ordering: the optional Compare template argument (less<T> by default) orders the items, and two items are 
+the same when neither compares less than the other, so T needs no operator< (operator== is only used when 
+two SkipLists are compared). A comparator may be passed to the constructor: SkipList<int, greater<int>> objectName(1, greater<int>());
+When Compare declares is_transparent, as less<> does, contains, find, lower_bound, upper_bound, 
+equal_range and range also accept keys of other types, e.g. a string_view for SkipList<string, less<>>.
+Insertion: objectName.insert(type); Only unique values may be added to the SkipList (SkipMultiset.h keeps 
+equal items side by side in one).
+An rvalue passed to insert is moved into its node, and objectName.emplace(args...) constructs the item 
+inside its node; either way the item is stored once and is never copied between levels.
+Deletion: objectName.erase(type); objectName.erase(low, high) removes every item in [low, high) at once.
+Set algebra: a.merge(std::move(b)) moves the items of b into a, and a.set_union(b), set_intersection(b) and 
+set_difference(b) return a new SkipList; each walks both lowest levels once. Called on an rvalue, as in 
+std::move(a).set_intersection(b), they relink the nodes of a instead of copying them. a.split(key) moves 
+every item not less than key into a new SkipList by cutting each level at the boundary.
+Batches: objectName.insert_range(first, last) and erase_range(first, last) resume each search from where the 
+previous one ended, so a sorted batch of m items costs O(m + n) link steps rather than m searches.
 Check if item is in SkipList: objectName.contains(int value);
+Iteration: iterators are bidirectional, so for (auto it = objectName.rbegin(); it != objectName.rend(); ++it) 
+walks the items from the largest down, and front() and back() return the smallest and largest item in O(1).
+Ordered lookups: objectName.find(value), lower_bound(value), upper_bound(value) and equal_range(value) 
+return iterators positioned by a logarithmic search. for (auto x : objectName.range(a, b)) visits the 
+items in [a, b).
+Batched lookups: objectName.contains_batch(first, last, out) and find_batch(first, last, out) write one 
+result per key of [first, last). Sorted batches resume each search from the previous one; other batches 
+run several searches side by side and prefetch the next node of each.
+Positions: IndexedSkipList<type> (SkipList with Indexed = true) also answers rank(value), the number of 
+items less than value, and nth(k), at(k) and erase_at(k) for the item at 0-based position k, all in 
+logarithmic time. It stores one int per link in addition to the pointers.
+Snapshots: objectName.save(out) writes the items and node heights to a binary ostream, and 
+objectName.load(in) replaces the contents with a saved SkipList, keeping its heights, without a single 
+search. Items must be trivially copyable (but not pointers) or strings. save(out, false) stores the items 
+only, and load then draws new heights. MappedSkipList.h reads the same file in place through mmap.
+Diagnostics: objectName.validate() checks the ordering and the links of every level and returns false if 
+the SkipList is corrupt. Compiling with SKIPLIST_STATS defined also adds stats(), which reports the number 
+of nodes on each level, the node bytes in use and allocated, and the average and largest number of 
+comparisons and hops taken by contains, insert and erase, and reset_stats(). Without SKIPLIST_STATS the 
+counters do not exist and cost nothing. With it, concurrent readers of a const SkipList are no longer safe, 
+because contains updates the counters.
 Assumptions:
-In the constructor, it is assumed that the user will provide integer values that are greater than 0 
-and substantially less than the maximum value allowed by int, since large values (~1,000,000) will result 
-in a bad_alloc exception. Bad input in the constructor will cause program exit.
+In the constructor, it is assumed that the user will provide integer values that are greater than 0. 
+Values larger than MAX_LEVEL are reduced to MAX_LEVEL. Other values cause the constructor to throw 
+invalid_argument. No member function writes to the console except operator<<: an insert of an item that is 
+already present returns false in its pair, and an erase of an item that is absent returns 0.
 Description:
 The aim of this data structure is to create an STL-compliant container that approximates a combination of the 
 structural advantages of a linked list with the accessibility of an array. 
-Since this data structure uses a structure comparable to a doubly-linked list, a node object will be used 
-to store values and form doubly-linked connections between other nodes. This node will support up to four 
-connections: back, front, above, and below, and also contain an integer data field.
-The SkipList must be initialized by providing an integer value N for the number of levels to include in the 
+Since this data structure uses a structure comparable to a linked list, a node object will be used 
+to store values and form connections between other nodes. Each value is stored exactly once, in a single 
+node whose height is chosen when the value is inserted. The node holds an inline array of forward 
+pointers, one per level it occupies, and a back pointer on the lowest level.
+The SkipList may be initialized by providing an integer value N for the number of levels to include in the 
 SkipList. The SkipList will use arrays whose sizes are equal to N and whose indices form the individual 
-levels of the SkipList. Adding values to the SkipList requires an insertion function. The workings of this 
+levels of the SkipList. Whenever the number of items exceeds 2^N, a level is added to the arrays so that 
+searches remain logarithmic. Adding values to the SkipList requires an insertion function. The workings of this 
 method will capitalize off of the tiered structure of the SkipList to speed operations and thereby 
 approximate the instant accessibility of an array. It should insert the new item at the lowest level of 
 the SkipList, such that the items at that level are in sorted order. 
@@ -35,6 +80,9 @@ above. This must be determined by chance such that there is a 50% chance of addi
 immediately above. If it is determined that it should add a value above, then this will be done such that 
 the level remains in sorted order. This process is then repeated at the next level. This continues up until 
 it either adds the item to the highest level or determines not to add any more instances of the item.
+The chance is decided by the LevelGenerator of the SkipList, which draws the whole height from a single 
+random word. A LevelGenerator with another promotion probability (such as 1/4 or 1/e) or a fixed seed can 
+be passed to the constructor: SkipList<type> objectName(1, LevelGenerator(LevelGenerator::QUARTER, seed));
 Since the levels and nodes contained in the SkipList are determined at runtime, this data structure will 
 require dynamic memory allocation. Hence, the destructor will need to directly deallocate the contents of 
 the SkipList.
@@ -44,97 +92,445 @@ the SkipList.
 
 #include <iostream>
 #include <vector>
-#include <random>
 #include <limits>
 #include <iterator>
 #include <cstddef>
+#include <utility>
+#include <new>
+#include <memory>
+#include <stdexcept>
+#include <algorithm>
+#include "LevelGenerator.h"
+#include "SkipListSnapshot.h"
 
 using namespace std;
 
-template<class T>
+template<class T, class Compare = less<T>, class Allocator = allocator<T>, bool Indexed = false>
 
 class SkipList {
 
 
-   // Function purpose: Print a SkipList using cout <<
+   // Function purpose: Print a SkipList using <<
    // Parameters: N/A
    // Preconditions: An initialized SkipList
-   // Postconditions: Each level of the SkipList is printed to the console
+   // Postconditions: Each level of the SkipList is written to out
    // Return value: ostream
    // Functions called: N/A
-   template<class TypeName>
-   friend ostream& operator<<(ostream &out, const SkipList<TypeName> &skip); 
+   template<class TypeName, class Comp, class Alloc, bool Idx>
+   friend ostream& operator<<(ostream &out, const SkipList<TypeName, Comp, Alloc, Idx> &skip); 
+
+   // SkipMap stores its entries in a SkipList and searches and links its nodes directly
+   template<class Key, class Value, class KeyCompare, class Alloc>
+   friend class SkipMap;
+
+   // SkipMultiset stores equal items next to each other and positions them with the same searches
+   template<class Item, class ItemCompare, class Alloc>
+   friend class SkipMultiset;
 
 private:
    
    struct SkipListNode {
       // Function purpose: Initilize a SkipListNode
-      // Parameters: A data type<T>
-      // Preconditions: Any numerical data types are less than its extreme values
-      // Postconditions: An initilized SkipListNode
+      // Parameters: The number of levels the node occupies and the arguments of the constructor of T
+      // Preconditions: height is > 0 and storage for height forward pointers follows the node
+      // Postconditions: An initilized SkipListNode with all forward pointers set to nullptr
       // Return value: N/A
       // Functions called: N/A
-      explicit SkipListNode(T data);
+      template<class... Args>
+      SkipListNode(int height, Args&&... args);
+
+      // Function purpose: To access the forward pointer of the node at a given level
+      // Parameters: An int for the level
+      // Preconditions: 0 <= level < height_
+      // Postconditions: N/A
+      // Return value: reference to the forward pointer
+      // Functions called: N/A
+      SkipListNode*& next(int level);
+      SkipListNode* next(int level) const;
+
+      // Function purpose: To access the width of the forward link of the node at a given level
+      // Parameters: An int for the level
+      // Preconditions: Indexed is true and 0 <= level < height_
+      // Postconditions: N/A
+      // Return value: reference to the number of lowest-level steps the link spans
+      // Functions called: N/A
+      int& width(int level);
+
       T data_;
-      SkipListNode* next_;
       SkipListNode* prev_;
-      SkipListNode* upLevel_;
-      SkipListNode* downLevel_;
+      int height_;
+      // height_ forward pointers are stored directly after the node in the same allocation, followed by 
+      // height_ link widths when the SkipList is Indexed
+   };
+
+public:
+
+   // Upper bound on the number of levels; enough for 2^32 items at a promotion chance of 50%
+   static constexpr int MAX_LEVEL = 32;
+
+private:
+
+   // The predecessors of a search on every level, and their 1-based positions when the SkipList is Indexed.
+   // Both are held inline with room for MAX_LEVEL levels, so a search path lives on the stack and a lookup or
+   // mutation allocates nothing but the node it adds.
+   struct SearchPath {
+      // Function purpose: To initialize a SearchPath
+      // Parameters: An int for the number of levels in use
+      // Preconditions: 0 < levels <= MAX_LEVEL
+      // Postconditions: The first levels predecessors are the heads
+      // Return value: N/A
+      // Functions called: N/A
+      explicit SearchPath(int levels);
+
+      SkipListNode* nodes_[MAX_LEVEL];
+      int ranks_[Indexed ? MAX_LEVEL : 1];
    };
 
+   // Unit in which node blocks are requested from the allocator
+   struct NodeSlot {
+      alignas(SkipListNode) unsigned char bytes_[alignof(SkipListNode)];
+   };
+
+   using NodeAllocator = typename allocator_traits<Allocator>::template rebind_alloc<NodeSlot>;
+   using NodeTraits = allocator_traits<NodeAllocator>;
+
+   NodeAllocator nodeAlloc_;
+   Compare comp_;
+
+   // Number of searches that a batched lookup advances in turn, so that each can wait on a prefetch
+   static constexpr int BATCH_WIDTH = 16;
+
    int maxLevel_;
    int size_;
+   LevelGenerator levelGenerator_;
    SkipListNode** heads_;
    SkipListNode** tails_;
+   // Width of the link from the head on each level; nullptr unless Indexed
+   int* headWidths_;
 
-   // Function purpose: To insert a SkipListNode at a specific level in the SkipList
-   // Parameters: Two SkipListNode pointers, and two data types
-   // Preconditions: Pointers are not nullptrs and int level is > 0 
-   // Postconditions: A SkipListNode is added to the level
+   // Operations whose searches are counted when SKIPLIST_STATS is defined
+   enum class StatsOperation { CONTAINS, INSERT, ERASE };
+
+   // Set operations carried out by appendMerged and spliceMerged
+   enum class SetOperation { UNION, INTERSECTION, DIFFERENCE };
+
+#ifdef SKIPLIST_STATS
+public:
+
+   // Search work done by one kind of operation since construction or the last reset_stats
+   struct OperationStats {
+      long count = 0;
+      long comparisons = 0;
+      long hops = 0;
+      long maxComparisons = 0;
+      long maxHops = 0;
+
+      // Function purpose: To return the mean number of comparisons or hops per operation
+      // Parameters: N/A
+      // Preconditions: N/A
+      // Postconditions: N/A
+      // Return value: double; 0 if no operation has been counted
+      // Functions called: N/A
+      double averageComparisons() const;
+      double averageHops() const;
+   };
+
+   // The shape of the SkipList and the work done by its operations
+   struct Stats {
+      // Number of nodes on each level, lowest level first
+      vector<int> levelCounts;
+      OperationStats contains;
+      OperationStats insert;
+      OperationStats erase;
+      // Bytes held by the nodes now in the SkipList, and bytes requested for nodes since the last reset
+      size_t nodeBytes;
+      size_t allocatedNodeBytes;
+   };
+
+private:
+
+   // Work of the search in progress
+   mutable long searchComparisons_ = 0;
+   mutable long searchHops_ = 0;
+   mutable OperationStats containsStats_;
+   mutable OperationStats insertStats_;
+   mutable OperationStats eraseStats_;
+   size_t allocatedNodeBytes_ = 0;
+#endif
+
+   // Function purpose: To count the work of a search when SKIPLIST_STATS is defined; does nothing otherwise
+   // Parameters: The number of items compared against and the number of links followed
+   // Preconditions: N/A
+   // Postconditions: The counters of the search in progress have grown
    // Return value: void
-   // Functions called: addBefore
-   void insertAtLevel(SkipListNode *newValue, SkipListNode *beforeNode, int const level, const T data);
+   // Functions called: N/A
+   void countSearch(int comparisons, int hops) const;
 
-   // Function purpose: To determine whether to add a SkipListNode to the next level
+   // Function purpose: To start counting the search of an operation when SKIPLIST_STATS is defined
    // Parameters: N/A
    // Preconditions: N/A
-   // Postconditions: 1 or 0 has been returned, with a 50% chance of either
-   // Return value: bool
+   // Postconditions: The counters of the search in progress are zero
+   // Return value: void
    // Functions called: N/A
-   bool alsoHigher() const;
+   void beginSearch() const;
 
-   // Function purpose: To insert a SkipListNode above a particular level in the SkipList
-   // Parameters: an data type representing the itemto be added, a SkipListNode pointer, and a reference to 
-   // a vector of before nodes
-   // Preconditions: An item has been added to a SkipList
-   // Postconditions: A SkipListNode is added to the level above
+   // Function purpose: To add the search in progress to the stats of an operation when SKIPLIST_STATS is 
+   // defined
+   // Parameters: The operation that made the search
+   // Preconditions: beginSearch was called before the search
+   // Postconditions: The operation has been counted
    // Return value: void
-   // Functions called: alsoHigher, insertAtLevel, addAbove
-   void insertHigher(const T data, SkipListNode *base, vector<SkipListNode*>& beforeNodes);
+   // Functions called: N/A
+   void finishSearch(StatsOperation operation) const;
+
+   // Function purpose: To allocate a SkipListNode and its forward pointers in a single block
+   // Parameters: The number of levels the node occupies and the arguments of the constructor of T
+   // Preconditions: height is > 0
+   // Postconditions: A SkipListNode that is not linked into any level
+   // Return value: SkipListNode pointer
+   // Functions called: nodeSlots
+   template<class... Args>
+   SkipListNode* createNode(int height, Args&&... args);
 
-   // Function purpose: To connect two SkipLIstNodes using prev_ and next_ pointers
-   // Parameters: Two SkipListNode pointers
-   // Preconditions: Parameters are not nullptrs
-   // Postconditions: Two horizontally connected SkipListNodes
+   // Function purpose: To destroy a SkipListNode and release its block
+   // Parameters: A SkipListNode pointer
+   // Preconditions: Node was returned by createNode and is no longer linked
+   // Postconditions: The node no longer exists in memory
    // Return value: void
+   // Functions called: nodeSlots
+   void destroyNode(SkipListNode *node);
+
+   // Function purpose: To compute how many NodeSlots a node of a given height occupies
+   // Parameters: An int for the height
+   // Preconditions: height is > 0
+   // Postconditions: N/A
+   // Return value: size_t
    // Functions called: N/A
-   static void addBefore(SkipListNode *newNode, SkipListNode *nextNode);
+   static size_t nodeSlots(int height);
+
+   // Function purpose: To return the node following a predecessor at a given level
+   // Parameters: A SkipListNode pointer (nullptr stands for the head of the level) and an int for the level
+   // Preconditions: pred occupies the level if it is not nullptr
+   // Postconditions: N/A
+   // Return value: SkipListNode pointer
+   // Functions called: N/A
+   SkipListNode* successor(SkipListNode *pred, int level) const;
+
+   // Function purpose: To insert a SkipListNode at a specific level in the SkipList
+   // Parameters: The new SkipListNode pointer, its predecessor (nullptr for the head) and the level
+   // Preconditions: newValue is not a nullptr and 0 <= level < newValue->height_
+   // Postconditions: A SkipListNode is added to the level
+   // Return value: void
+   // Functions called: successor
+   void insertAtLevel(SkipListNode *newValue, SkipListNode *beforeNode, int const level);
 
-   // Function purpose: To connect two SkipLIstNodes using upLevel_ and downLevel_ pointers
-   // Parameters: Two SkipListNode pointers
-   // Preconditions: Parameters are not nullptrs
-   // Postconditions: Two vertically connected SkipListNodes
+   // Function purpose: To unlink a SkipListNode from a specific level in the SkipList
+   // Parameters: The SkipListNode pointer to remove, its predecessor (nullptr for the head) and the level
+   // Preconditions: toRemove is linked at the level directly after beforeNode
+   // Postconditions: The SkipListNode is no longer reachable at the level
    // Return value: void
    // Functions called: N/A
-   static void addAbove(SkipListNode *newNode, SkipListNode *belowNode);
+   void removeAtLevel(SkipListNode *toRemove, SkipListNode *beforeNode, int const level);
+
+   // Function purpose: To return the width of the link that leaves a predecessor at a given level
+   // Parameters: A SkipListNode pointer (nullptr stands for the head of the level) and an int for the level
+   // Preconditions: Indexed is true
+   // Postconditions: N/A
+   // Return value: reference to the width; a link to nullptr spans up to position size_ + 1
+   // Functions called: SkipListNode::width
+   int& linkWidth(SkipListNode *pred, int level) const;
+
+   // Function purpose: To find the last node before an item on every level
+   // Parameters: An item to search for and a SearchPath with maxLevel_ levels to receive the predecessors
+   // Preconditions: Initialized SkipList
+   // Postconditions: beforeNodes.nodes_[i] is the last node on level i that is less than data (nullptr for 
+   // the head) and, if Indexed, beforeNodes.ranks_[i] is its position (0 for the head)
+   // Return value: The first node on the lowest level that is not less than data, or nullptr
+   // Functions called: successor, linkWidth
+   template<class K>
+   SkipListNode* findPredecessors(const K& data, SearchPath& beforeNodes) const;
+
+   // Function purpose: To find the last node that is not greater than an item on every level
+   // Parameters: An item to search for and a SearchPath with maxLevel_ levels to receive the predecessors
+   // Preconditions: Initialized SkipList
+   // Postconditions: beforeNodes.nodes_[i] is the last node on level i that is not greater than data 
+   // (nullptr for the head) and, if Indexed, beforeNodes.ranks_[i] is its position (0 for the head)
+   // Return value: The first node on the lowest level that is greater than data, or nullptr
+   // Functions called: successor, linkWidth
+   template<class K>
+   SkipListNode* findUpperPredecessors(const K& data, SearchPath& beforeNodes) const;
+
+   // Function purpose: To find the node at a position and, optionally, its predecessor on every level
+   // Parameters: A 0-based index and a SearchPath with maxLevel_ levels, or nullptr
+   // Preconditions: Indexed is true and 0 <= index < size_
+   // Postconditions: beforeNodes, if given, holds the predecessors of the node and their positions
+   // Return value: SkipListNode pointer
+   // Functions called: successor, linkWidth
+   SkipListNode* findIndex(int index, SearchPath *beforeNodes) const;
+
+   // Function purpose: To find the predecessors of an item starting from the predecessors of an earlier search
+   // Parameters: An item to search for and a SearchPath left by an earlier search (or all heads)
+   // Preconditions: Initialized SkipList; finger has an entry for every level
+   // Postconditions: finger holds the predecessors of data and, if Indexed, their positions
+   // Return value: The first node on the lowest level that is not less than data, or nullptr
+   // Functions called: successor, linkWidth
+   template<class K>
+   SkipListNode* fingerSearch(const K& data, SearchPath& finger) const;
+
+   // Function purpose: To find the first node that is not less than each key of a batch
+   // Parameters: Forward iterators to the first and past the last key, and a function called with the node 
+   // found and the key, in the order of the keys
+   // Preconditions: Initialized SkipList
+   // Postconditions: visit has been called once per key
+   // Return value: void
+   // Functions called: fingerSearch, successor
+   template<class ForwardIt, class Visitor>
+   void searchBatch(ForwardIt first, ForwardIt last, Visitor visit) const;
+
+   // Function purpose: To link a new node after its predecessors on every level it occupies
+   // Parameters: The new SkipListNode pointer and the predecessors found by findPredecessors
+   // Preconditions: The predecessors were found for the item of newValue and nothing was linked since
+   // Postconditions: The node is in the SkipList, link widths are updated and size_ has been incremented
+   // Return value: void
+   // Functions called: insertAtLevel, linkWidth, growIfNeeded
+   void linkNode(SkipListNode *newValue, SearchPath& beforeNodes);
+
+   // Function purpose: To unlink a node from every level it occupies and destroy it
+   // Parameters: The SkipListNode pointer to remove and the predecessors found by findPredecessors
+   // Preconditions: toRemove is the node returned by findPredecessors for the same search
+   // Postconditions: The node no longer exists, link widths are updated and size_ has been decremented
+   // Return value: void
+   // Functions called: removeAtLevel, linkWidth, destroyNode
+   void unlinkNode(SkipListNode *toRemove, SearchPath& beforeNodes);
+
+   // Function purpose: To unlink and destroy every node between two sets of predecessors
+   // Parameters: The predecessors of the first node to remove and the predecessors of the first node to keep
+   // Preconditions: Both were found on the current links and after is not before before on any level
+   // Postconditions: Each level links its node of before to the node following its node of after, link 
+   // widths are updated and size_ has been reduced
+   // Return value: int for the number of nodes removed
+   // Functions called: successor, linkWidth, destroyNode
+   int eraseBetween(SearchPath& before, SearchPath& after);
+
+   // Function purpose: To check the structure of the SkipList, with or without equal items
+   // Parameters: A bool that is true if equal items may follow each other
+   // Preconditions: Initialized SkipList
+   // Postconditions: N/A
+   // Return value: bool that is true if every level is increasing (non-decreasing if allowEqual) and a 
+   // subsequence of the level below, heads_, tails_, prev_ and size_ agree with the links and, if Indexed, 
+   // every width is correct
+   // Functions called: linkWidth
+   bool checkStructure(bool allowEqual) const;
+
+   // Function purpose: To find the first node that is not less than an item
+   // Parameters: An item to search for
+   // Preconditions: Initialized SkipList
+   // Postconditions: N/A
+   // Return value: SkipListNode pointer, or nullptr if every item is less than data
+   // Functions called: successor
+   template<class K>
+   SkipListNode* lowerBoundNode(const K& data) const;
+
+   // Function purpose: To find the first node that is greater than an item
+   // Parameters: An item to search for
+   // Preconditions: Initialized SkipList
+   // Postconditions: N/A
+   // Return value: SkipListNode pointer, or nullptr if no item is greater than data
+   // Functions called: successor
+   template<class K>
+   SkipListNode* upperBoundNode(const K& data) const;
+
+   // Function purpose: To choose the number of levels a new SkipListNode occupies
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: A height between 1 and maxLevel_ has been returned
+   // Return value: int
+   // Functions called: LevelGenerator::height
+   int randomHeight();
+
+   // Function purpose: To add levels to heads_ and tails_
+   // Parameters: An int for the new number of levels
+   // Preconditions: maxLevel_ < newLevel <= MAX_LEVEL
+   // Postconditions: heads_ and tails_ have newLevel entries; the new levels are empty
+   // Return value: void
+   // Functions called: N/A
+   void growLevels(int newLevel);
+
+   // Function purpose: To add a level when the number of items outgrows the current levels
+   // Parameters: N/A
+   // Preconditions: Initialized SkipList
+   // Postconditions: maxLevel_ is large enough for size_ items, or equal to MAX_LEVEL
+   // Return value: void
+   // Functions called: LevelGenerator::capacity, growLevels
+   void growIfNeeded();
 
    // Function purpose: To copy the items in one SkipList and add them to the current object
    // Parameters: An initialized SkipList
    // Preconditions: SkipList is empty
-   // Postconditions: SkipList container the same items as the parameter  
+   // Postconditions: SkipList container the same items as the parameter, with the same node heights
    // Return value: void
+   // Functions called: growLevels, appendNode
+   void copyContents(const SkipList<T, Compare, Allocator, Indexed>& skip);
+
+   // Function purpose: To add a node after the last item of every level it occupies
+   // Parameters: The item to store and the height of the new node
+   // Preconditions: SkipList is empty or its last item is less than data; height <= maxLevel_
+   // Postconditions: The item is the last item of the SkipList
+   // Return value: SkipListNode pointer
+   // Functions called: createNode, appendLinked
+   SkipListNode* appendNode(const T& data, int height);
+
+   // Function purpose: To add an allocated node after the last item of every level it occupies
+   // Parameters: The SkipListNode pointer, which is not linked into any SkipList
+   // Preconditions: SkipList is empty or its last item is less than the item of node; node->height_ <= 
+   // maxLevel_; the node was allocated by an allocator equal to nodeAlloc_
+   // Postconditions: The item is the last item of the SkipList
+   // Return value: void
+   // Functions called: insertAtLevel, linkWidth
+   void appendLinked(SkipListNode *node);
+
+   // Function purpose: To empty the SkipList without releasing its nodes
+   // Parameters: N/A
+   // Preconditions: Initialized SkipList
+   // Postconditions: The SkipList is empty; the former nodes are still chained on the lowest level
+   // Return value: The former first node, or nullptr
    // Functions called: N/A
-   void copyContents(const SkipList<T>& skip);
+   SkipListNode* detachAll();
+
+   // Function purpose: To append the result of a set operation on two SkipLists, copying the items kept
+   // Parameters: The two SkipLists and the operation
+   // Preconditions: This SkipList is empty and is neither parameter
+   // Postconditions: This SkipList holds the result, with the node heights of the items it was built from
+   // Return value: void
+   // Functions called: growLevels, appendNode, growIfNeeded
+   void appendMerged(const SkipList& first, const SkipList& second, SetOperation operation);
+
+   // Function purpose: To replace the contents with the result of a set operation with another SkipList, 
+   // relinking the nodes of this SkipList that are kept
+   // Parameters: The other SkipList and the operation
+   // Preconditions: Initialized SkipLists
+   // Postconditions: This SkipList holds the result; its dropped nodes have been released
+   // Return value: void
+   // Functions called: clear, growLevels, detachAll, appendLinked, appendNode, destroyNode, growIfNeeded
+   void spliceMerged(const SkipList& other, SetOperation operation);
+
+   // Function purpose: To add a range of items, appending in one pass while the range is increasing
+   // Parameters: Input iterators to the first and past the last item
+   // Preconditions: Initialized SkipList
+   // Postconditions: Every item of the range is in the SkipList
+   // Return value: void
+   // Functions called: appendNode, randomHeight, growIfNeeded, insert
+   template<class InputIt>
+   void appendRange(InputIt first, InputIt last);
+
+   // Function purpose: To write or read raw bytes of a snapshot
+   // Parameters: The stream, the bytes and their number
+   // Preconditions: N/A
+   // Postconditions: The bytes have been written or read
+   // Return value: void; throws runtime_error if the stream fails
+   // Functions called: N/A
+   static void writeBytes(ostream& out, const void *bytes, size_t length);
+   static void readBytes(istream& in, void *bytes, size_t length);
 
    // Function purpose: To initilize heads_ and tails_ pointers that were set to nullptr
    // Parameters: An int for the number of levels
@@ -146,9 +542,12 @@ private:
 
 public:
 
+   using allocator_type = Allocator;
+   using key_compare = Compare;
+
    class iterator {
       public:
-      using iterator_category = std::forward_iterator_tag;
+      using iterator_category = std::bidirectional_iterator_tag;
       using difference_type = std::ptrdiff_t;
       using value_type = T;
       using pointer = const T*;
@@ -157,10 +556,10 @@ public:
       // Function purpose: To construct an iterator for the SkipList
       // Parameters: A pointer to a SkipList and a pointer to one of its SkipListNodes
       // Preconditions: Initialized SkipList
-      // Postconditions: Iterator located at SkipListNode in SkipList
+      // Postconditions: Iterator located at SkipListNode in SkipList (end() if nullptr)
       // Return value: N/A
       // Functions called: N/A
-      iterator(SkipList<T> *skpPtr_, SkipListNode *nodePtr_ = nullptr);
+      iterator(const SkipList<T, Compare, Allocator, Indexed> *skpPtr = nullptr, SkipListNode *nodePtr = nullptr);
 
       // Function purpose: To return the item stored in nodePtr_
       // Parameters: N/A
@@ -169,8 +568,9 @@ public:
       // Return value: const referenst to type <T>
       // Functions called: N/A
       const T& operator*() const;
+      const T* operator->() const;
 
-      // Function purpose: To increment the iterator to the item in nodePtr->next_ (prefix incrementation)
+      // Function purpose: To increment the iterator to the item in nodePtr->next(0) (prefix incrementation)
       // Parameters: N/A
       // Preconditions: Initialized iterator
       // Postconditions: Incremented iterator 
@@ -178,7 +578,7 @@ public:
       // Functions called: N/A
       iterator& operator++();
 
-      // Function purpose: To return the current iterator, then increment it to the item in nodePtr->next_ (postfix incrementation)
+      // Function purpose: To return the current iterator, then increment it to the item in nodePtr->next(0) (postfix incrementation)
       // Parameters: N/A
       // Preconditions: Initialized iterator
       // Postconditions: Iterator located at the current position of iterator before it was incremented
@@ -186,13 +586,22 @@ public:
       // Functions called: N/A
       iterator operator++(int);
 
-      // Function purpose: To set current iterator to the same location as another iterator
+      // Function purpose: To decrement the iterator to the item in nodePtr->prev_, or from end() to the last 
+      // item (prefix decrementation)
       // Parameters: N/A
-      // Preconditions: An initialized iterator
-      // Postconditions: Iterator located at the same position as its right-hand argument 
-      // Return value: iterator reference
-      // Functions called: N/A      
-      iterator& operator=(const iterator& rhs);
+      // Preconditions: Initialized iterator that is not at begin()
+      // Postconditions: Decremented iterator 
+      // Return value: iterator
+      // Functions called: N/A
+      iterator& operator--();
+
+      // Function purpose: To return the current iterator, then decrement it (postfix decrementation)
+      // Parameters: N/A
+      // Preconditions: Initialized iterator that is not at begin()
+      // Postconditions: Iterator located at the current position of iterator before it was decremented
+      // Return value: iterator
+      // Functions called: N/A
+      iterator operator--(int);
 
       // Function purpose: To determine whether two iterators are at the same location (equal)
       // Parameters: N/A
@@ -207,35 +616,116 @@ public:
       // Preconditions: An initialized iterator
       // Postconditions: bool reflecting whether two iterators are not at the same location
       // Return value: bool
-      // Functions called: N/A
+      // Functions called: operator==
       bool operator!=(const iterator& rhs) const;
       private:
-      SkipList<T> *skpPtr_;
+      const SkipList<T, Compare, Allocator, Indexed> *skpPtr_;
       SkipListNode *nodePtr_;
    };
 
+   // Items cannot be modified through an iterator, so the const forms are the same types
+   using const_iterator = iterator;
+   using reverse_iterator = std::reverse_iterator<iterator>;
+   using const_reverse_iterator = reverse_iterator;
+
+   class range_view {
+      public:
+      // Function purpose: To construct a view over the items between two iterators
+      // Parameters: Iterators to the first item and past the last item of the view
+      // Preconditions: last is reachable from first
+      // Postconditions: An initialized range_view
+      // Return value: N/A
+      // Functions called: N/A
+      range_view(iterator first, iterator last);
+
+      // Function purpose: To return the iterators that bound the view, for use in range-based for loops
+      // Parameters: N/A
+      // Preconditions: Initialized range_view
+      // Postconditions: N/A
+      // Return value: iterator
+      // Functions called: N/A
+      iterator begin() const;
+      iterator end() const;
+
+      // Function purpose: To indicate whether the view holds no items
+      // Parameters: N/A
+      // Preconditions: Initialized range_view
+      // Postconditions: N/A
+      // Return value: bool
+      // Functions called: N/A
+      bool empty() const;
+      private:
+      iterator first_;
+      iterator last_;
+   };
+
    // Function purpose: To initialize a SkipList object
-   // Parameters: A data type <T>
+   // Parameters: The number of levels and the allocator used for nodes
+   // Preconditions: skiplist.h has been included in the driver file
+   // Postconditions: An initilized SkipList 
+   // Return value: N/A
+   // Functions called: N/A
+   explicit SkipList(int maxLevel = 1, const Allocator& alloc = Allocator());
+
+   // Function purpose: To initialize a SkipList object that orders its items with a given comparator
+   // Parameters: The number of levels, the comparator and the allocator used for nodes
+   // Preconditions: comp is a strict weak ordering
+   // Postconditions: An initilized SkipList 
+   // Return value: N/A; throws invalid_argument if maxLevel <= 0
+   // Functions called: N/A
+   SkipList(int maxLevel, const Compare& comp, const Allocator& alloc = Allocator());
+
+   // Function purpose: To initialize a SkipList object that draws node heights from a given generator
+   // Parameters: The number of levels, the LevelGenerator and the allocator used for nodes
    // Preconditions: skiplist.h has been included in the driver file
    // Postconditions: An initilized SkipList 
    // Return value: N/A
    // Functions called: N/A
-   explicit SkipList(int maxLevel = 1);
+   SkipList(int maxLevel, const LevelGenerator& generator, const Allocator& alloc = Allocator());
 
    // Function purpose: To initialilize a SkipList using initializer_list
-   // Parameters: an initilization list
+   // Parameters: an initilization list and the allocator used for nodes
    // Preconditions: N/A
    // Postconditions: initilized Skiplist
    // Return value: N/A
    // Functions called: N/A
-   SkipList(initializer_list<T> vals);
+   SkipList(initializer_list<T> vals, const Allocator& alloc = Allocator());
+
+   // Function purpose: To initialilize a SkipList using initializer_list and a comparator
+   // Parameters: an initilization list, the comparator and the allocator used for nodes
+   // Preconditions: comp is a strict weak ordering
+   // Postconditions: initilized Skiplist
+   // Return value: N/A
+   // Functions called: appendRange
+   SkipList(initializer_list<T> vals, const Compare& comp, const Allocator& alloc = Allocator());
+
+   // Function purpose: To initialize a SkipList from an iterator range
+   // Parameters: Input iterators to the first and past the last item, and the allocator used for nodes
+   // Preconditions: N/A
+   // Postconditions: initilized SkipList holding the unique items of the range; O(n) if the range is 
+   // strictly increasing
+   // Return value: N/A
+   // Functions called: appendRange
+   template<class InputIt, class = typename iterator_traits<InputIt>::iterator_category>
+   SkipList(InputIt first, InputIt last, const Allocator& alloc = Allocator());
+
+   // Function purpose: To initialize a SkipList from an iterator range and a comparator
+   // Parameters: Input iterators to the first and past the last item, the comparator and the allocator used 
+   // for nodes
+   // Preconditions: comp is a strict weak ordering
+   // Postconditions: initilized SkipList holding the unique items of the range; O(n) if the range is 
+   // strictly increasing
+   // Return value: N/A
+   // Functions called: appendRange
+   template<class InputIt, class = typename iterator_traits<InputIt>::iterator_category>
+   SkipList(InputIt first, InputIt last, const Compare& comp, const Allocator& alloc = Allocator());
 
    // Function purpose: To destroy a SkipList object after program execution
    // Parameters: N/A
    // Preconditions: An initilized SkipList 
    // Postconditions: SkipList no longer exists in memory
    // Return value: N/A
-   // Functions called: erase
+   // Functions called: clear
    virtual ~SkipList();
 
    // Function purpose: To copy-construct a SkipList
@@ -257,15 +747,15 @@ public:
    // Function purpose: To move-construct a SkipList
    // Parameters: moved Skiplist
    // Preconditions: Initialized SkipList
-   // Postconditions: Move constructed Skiplist
+   // Postconditions: Move constructed Skiplist; toMove is an empty SkipList with one level
    // Return value: reference to SkipList
-   // Functions called: N/A
+   // Functions called: initializeFields
    SkipList(SkipList&& toMove);
 
    // Function purpose: To move-assign a SkipList
    // Parameters: moved Skiplist as right hand argument
    // Preconditions: Initialized SkipLists
-   // Postconditions: Moved Skiplist
+   // Postconditions: Moved Skiplist; rhs is an empty SkipList with one level
    // Return value: reference to SkipList
    // Functions called: initilizeFields
    SkipList& operator=(SkipList&& rhs);
@@ -287,28 +777,287 @@ public:
    bool operator!=(const SkipList& rhs) const;
 
    // Function purpose: To add a SkipListNode containing a unique item to a SkipList
-   // Parameters: An item to add to a SkipListNode that is placed in the SkipList
-   // Preconditions: Any numerical parameters are less than extreme values; an initilized SkipList
-   // Postconditions: A bool reflecting the success of the insertion operation
-   // Return value: bool
-   // Functions called: contains, insertAtLevel, insertHigher
-   bool insert(T data);
+   // Parameters: An item to copy or move into a SkipListNode that is placed in the SkipList
+   // Preconditions: An initilized SkipList
+   // Postconditions: The item is in the SkipList; it is only copied or moved if it was not already there
+   // Return value: pair of an iterator to the item and a bool that is true if the item was inserted
+   // Functions called: insertUnique
+   pair<iterator, bool> insert(const T& data);
+   pair<iterator, bool> insert(T&& data);
+
+   // Function purpose: To construct an item in place inside a new SkipListNode and add it to the SkipList
+   // Parameters: The arguments of the constructor of T
+   // Preconditions: An initilized SkipList
+   // Postconditions: The item is in the SkipList; the new node is destroyed if an equal item was already there
+   // Return value: pair of an iterator to the item and a bool that is true if the item was inserted
+   // Functions called: createNode, randomHeight, findPredecessors, linkNode, destroyNode
+   template<class... Args>
+   pair<iterator, bool> emplace(Args&&... args);
+
+   // Function purpose: To add a range of items, resuming each search from the predecessors of the last one
+   // Parameters: Input iterators to the first and past the last item
+   // Preconditions: Initialized SkipList
+   // Postconditions: Every item of the range is in the SkipList; items that were already there are skipped
+   // Return value: int for the number of items inserted
+   // Functions called: fingerSearch, randomHeight, createNode, linkNode
+   template<class InputIt>
+   int insert_range(InputIt first, InputIt last);
+
+   // Function purpose: To remove a range of items, resuming each search from the predecessors of the last one
+   // Parameters: Input iterators to the first and past the last item
+   // Preconditions: Initialized SkipList
+   // Postconditions: No item of the range is in the SkipList
+   // Return value: int for the number of items removed
+   // Functions called: fingerSearch, unlinkNode
+   template<class InputIt>
+   int erase_range(InputIt first, InputIt last);
+
+   // Function purpose: To replace the contents of the SkipList with a sorted range of unique items
+   // Parameters: Input iterators to the first and past the last item
+   // Preconditions: The range is strictly increasing; items out of order are inserted one by one
+   // Postconditions: The SkipList holds exactly the items of the range
+   // Return value: void
+   // Functions called: clear, appendRange
+   template<class InputIt>
+   void assign_sorted(InputIt first, InputIt last);
+
+   // Function purpose: To write the SkipList to a binary snapshot
+   // Parameters: The output stream and whether the levels above the lowest are stored
+   // Preconditions: T is trivially copyable but not a pointer, or string
+   // Postconditions: The snapshot described in SkipListSnapshot.h has been written to out
+   // Return value: void; throws runtime_error if the stream fails
+   // Functions called: SkipListSnapshot::makeHeader, writeBytes
+   void save(ostream& out, bool towers = true) const;
+
+   // Function purpose: To replace the contents of the SkipList with a binary snapshot
+   // Parameters: The input stream
+   // Preconditions: T is trivially copyable but not a pointer, or string
+   // Postconditions: The SkipList holds the saved items, with the saved heights if towers were stored
+   // Return value: void; throws runtime_error if the snapshot is invalid, leaving the SkipList unchanged
+   // Functions called: SkipListSnapshot::checkHeader, readBytes, clear, growLevels, appendNode, appendRange
+   void load(istream& in);
 
    // Function purpose: To check if the SkipList contains a given item
    // Parameters: An item to search for 
-   // Preconditions: Numerical parameters are less than extreme values 
+   // Preconditions: Initialized SkipList
    // Postconditions: A bool reflecting the existance of the object in the SkipList
    // Return value: bool
-   // Functions called: N/A
-   bool contains(T data) const;
+   // Functions called: lowerBoundNode
+   bool contains(const T& data) const;
+
+   // Function purpose: To locate a given item
+   // Parameters: An item to search for
+   // Preconditions: Initialized SkipList
+   // Postconditions: N/A
+   // Return value: iterator to the item, or end() if it is not in the SkipList
+   // Functions called: lowerBoundNode
+   iterator find(const T& data) const;
+
+   // Function purpose: To locate the first item that is not less than a given item
+   // Parameters: An item to search for
+   // Preconditions: Initialized SkipList
+   // Postconditions: N/A
+   // Return value: iterator, or end() if every item is less than data
+   // Functions called: lowerBoundNode
+   iterator lower_bound(const T& data) const;
+
+   // Function purpose: To locate the first item that is greater than a given item
+   // Parameters: An item to search for
+   // Preconditions: Initialized SkipList
+   // Postconditions: N/A
+   // Return value: iterator, or end() if no item is greater than data
+   // Functions called: upperBoundNode
+   iterator upper_bound(const T& data) const;
+
+   // Function purpose: To locate the items equal to a given item
+   // Parameters: An item to search for
+   // Preconditions: Initialized SkipList
+   // Postconditions: N/A
+   // Return value: pair of lower_bound(data) and the iterator after it if it holds data, or two equal iterators
+   // Functions called: lowerBoundNode
+   pair<iterator, iterator> equal_range(const T& data) const;
+
+   // Function purpose: To return a view over the items in the half-open interval [low, high)
+   // Parameters: The lower and upper bound of the interval
+   // Preconditions: Initialized SkipList
+   // Postconditions: N/A
+   // Return value: range_view, which is empty if high is not greater than low
+   // Functions called: lowerBoundNode
+   range_view range(const T& low, const T& high) const;
+
+   // Heterogeneous lookups, available when Compare declares is_transparent (e.g. less<>). They accept any 
+   // key that Compare can order against T, so no temporary T has to be constructed for the search.
+
+   // Function purpose: To check if the SkipList contains an item equivalent to a key of another type
+   // Parameters: A key that Compare can order against T
+   // Preconditions: Compare::is_transparent is defined
+   // Postconditions: A bool reflecting the existance of an equivalent item in the SkipList
+   // Return value: bool
+   // Functions called: lowerBoundNode
+   template<class K, class C = Compare, class = typename C::is_transparent>
+   bool contains(const K& key) const;
+
+   // Function purpose: To locate the item equivalent to a key of another type
+   // Parameters: A key that Compare can order against T
+   // Preconditions: Compare::is_transparent is defined
+   // Postconditions: N/A
+   // Return value: iterator to the item, or end() if there is none
+   // Functions called: lowerBoundNode
+   template<class K, class C = Compare, class = typename C::is_transparent>
+   iterator find(const K& key) const;
+
+   // Function purpose: To locate the first item that is not less than a key of another type
+   // Parameters: A key that Compare can order against T
+   // Preconditions: Compare::is_transparent is defined
+   // Postconditions: N/A
+   // Return value: iterator, or end() if every item is less than key
+   // Functions called: lowerBoundNode
+   template<class K, class C = Compare, class = typename C::is_transparent>
+   iterator lower_bound(const K& key) const;
+
+   // Function purpose: To locate the first item that is greater than a key of another type
+   // Parameters: A key that Compare can order against T
+   // Preconditions: Compare::is_transparent is defined
+   // Postconditions: N/A
+   // Return value: iterator, or end() if no item is greater than key
+   // Functions called: upperBoundNode
+   template<class K, class C = Compare, class = typename C::is_transparent>
+   iterator upper_bound(const K& key) const;
+
+   // Function purpose: To locate the items equivalent to a key of another type
+   // Parameters: A key that Compare can order against T
+   // Preconditions: Compare::is_transparent is defined
+   // Postconditions: N/A
+   // Return value: pair of iterators bounding the equivalent items
+   // Functions called: lowerBoundNode, upperBoundNode
+   template<class K, class C = Compare, class = typename C::is_transparent>
+   pair<iterator, iterator> equal_range(const K& key) const;
+
+   // Function purpose: To return a view over the items in [low, high) for keys of another type
+   // Parameters: The lower and upper bound of the interval
+   // Preconditions: Compare::is_transparent is defined
+   // Postconditions: N/A
+   // Return value: range_view, which is empty if high is not greater than low
+   // Functions called: lowerBoundNode
+   template<class K, class C = Compare, class = typename C::is_transparent>
+   range_view range(const K& low, const K& high) const;
+
+   // Function purpose: To check if the SkipList contains each key of a batch
+   // Parameters: Forward iterators to the first and past the last key, and an output iterator for the results
+   // Preconditions: Initialized SkipList; result can receive one bool per key
+   // Postconditions: One bool per key has been written to result, in the order of the keys
+   // Return value: Output iterator past the last result
+   // Functions called: searchBatch
+   template<class ForwardIt, class OutputIt>
+   OutputIt contains_batch(ForwardIt first, ForwardIt last, OutputIt result) const;
+
+   // Function purpose: To locate each key of a batch
+   // Parameters: Forward iterators to the first and past the last key, and an output iterator for the results
+   // Preconditions: Initialized SkipList; result can receive one iterator per key
+   // Postconditions: One iterator per key, end() if the key is absent, has been written to result in the 
+   // order of the keys
+   // Return value: Output iterator past the last result
+   // Functions called: searchBatch
+   template<class ForwardIt, class OutputIt>
+   OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt result) const;
 
    // Function purpose: To remove a SkipListNode containing a given item from the SkipList
    // Parameters: An item that is stored in a SkipListNode within the SkipList
-   // Preconditions: Parameter exists in the SkipList; an initilized SkipList
-   // Postconditions: A bool reflecting the success of the erase operation
-   // Return value: bool
-   // Functions called: contains, addBefore
-   bool erase(T data);
+   // Preconditions: An initilized SkipList
+   // Postconditions: The item is no longer in the SkipList
+   // Return value: int for the number of items removed (0 or 1)
+   // Functions called: findPredecessors, removeAtLevel, destroyNode
+   int erase(const T& data);
+
+   // Function purpose: To remove every item in the half-open interval [low, high)
+   // Parameters: The lower and upper bound of the interval
+   // Preconditions: Initialized SkipList
+   // Postconditions: No item in [low, high) is in the SkipList
+   // Return value: int for the number of items removed
+   // Functions called: findPredecessors, fingerSearch, eraseBetween
+   int erase(const T& low, const T& high);
+
+   // Set algebra. Each operation makes one pass over the lowest level of both SkipLists and appends the 
+   // items it keeps, so it costs O(n + m) and never searches. A SkipList passed or called as an rvalue 
+   // gives up its nodes: they are relinked into the result and only the nodes that are dropped are released.
+
+   // Function purpose: To move every item of another SkipList into this one
+   // Parameters: An rvalue SkipList
+   // Preconditions: Both SkipLists have the same ordering
+   // Postconditions: This SkipList holds the union of both, the parameter is empty, and the nodes of both 
+   // have been relinked rather than copied unless the allocators cannot free each other's nodes; items of the
+   // parameter already in this SkipList are released. This SkipList keeps its allocator, which relinked nodes 
+   // of the parameter share
+   // Return value: int for the number of items added
+   // Functions called: growLevels, detachAll, appendLinked, destroyNode, spliceMerged, growIfNeeded
+   int merge(SkipList&& other);
+
+   // Function purpose: To return the items that are in this SkipList or another
+   // Parameters: A SkipList
+   // Preconditions: Both SkipLists have the same ordering
+   // Postconditions: An rvalue this SkipList (or parameter) is left empty. The rvalue forms relink its nodes, so
+   // the result shares its allocator; the lvalue form copies, so the result gets the allocator of a copy
+   // Return value: SkipList holding the union, with the node heights of the items it was built from
+   // Functions called: appendMerged, spliceMerged, merge
+   SkipList set_union(const SkipList& other) const &;
+   SkipList set_union(const SkipList& other) &&;
+   SkipList set_union(SkipList&& other) &&;
+
+   // Function purpose: To return the items that are in both this SkipList and another
+   // Parameters: A SkipList
+   // Preconditions: Both SkipLists have the same ordering
+   // Postconditions: An rvalue this SkipList is left empty. The rvalue form relinks its nodes, so the result 
+   // shares its allocator; the lvalue form copies, so the result gets the allocator of a copy
+   // Return value: SkipList holding the intersection, with the node heights of this SkipList
+   // Functions called: appendMerged, spliceMerged
+   SkipList set_intersection(const SkipList& other) const &;
+   SkipList set_intersection(const SkipList& other) &&;
+
+   // Function purpose: To return the items of this SkipList that are not in another
+   // Parameters: A SkipList
+   // Preconditions: Both SkipLists have the same ordering
+   // Postconditions: An rvalue this SkipList is left empty. The rvalue form relinks its nodes, so the result 
+   // shares its allocator; the lvalue form copies, so the result gets the allocator of a copy
+   // Return value: SkipList holding the difference, with the node heights of this SkipList
+   // Functions called: appendMerged, spliceMerged
+   SkipList set_difference(const SkipList& other) const &;
+   SkipList set_difference(const SkipList& other) &&;
+
+   // Function purpose: To move every item that is not less than a key into a new SkipList
+   // Parameters: The key at which to split
+   // Preconditions: Initialized SkipList
+   // Postconditions: This SkipList holds the items less than key; no node is copied or reallocated, so the 
+   // result shares the allocator of this SkipList
+   // Return value: SkipList holding the items not less than key, with the same node heights
+   // Functions called: findPredecessors, successor, linkWidth
+   SkipList split(const T& key);
+
+   // Function purpose: To check the structure of the SkipList
+   // Parameters: N/A
+   // Preconditions: Initialized SkipList
+   // Postconditions: N/A
+   // Return value: bool that is true if every level is strictly increasing and a subsequence of the level 
+   // below, heads_, tails_, prev_ and size_ agree with the links and, if Indexed, every width is correct
+   // Functions called: checkStructure
+   bool validate() const;
+
+#ifdef SKIPLIST_STATS
+   // Function purpose: To report the shape of the SkipList and the work done by its operations
+   // Parameters: N/A
+   // Preconditions: Initialized SkipList
+   // Postconditions: N/A
+   // Return value: Stats
+   // Functions called: nodeSlots
+   Stats stats() const;
+
+   // Function purpose: To reset the operation and allocation counters
+   // Parameters: N/A
+   // Preconditions: Initialized SkipList
+   // Postconditions: Every counter reported by stats() except levelCounts and nodeBytes is zero
+   // Return value: void
+   // Functions called: N/A
+   void reset_stats();
+#endif
 
    // Function purpose: To return the number of items in the base level of the SkipList
    // Parameters: N/A
@@ -321,9 +1070,9 @@ public:
    // Function purpose: To remove the contents of a SkipList
    // Parameters: N/A
    // Preconditions: Initialized SkipList
-   // Postconditions: Empty SkipList
+   // Postconditions: Empty SkipList; every node has been released in a single pass over the lowest level
    // Return value: N/A
-   // Functions called: empty(), erase
+   // Functions called: destroyNode
    void clear();
 
    // Function purpose: To indicate whether a SkipList is empty
@@ -350,6 +1099,98 @@ public:
    // Functions called: iterator()
    iterator end() const;
 
+   // Function purpose: To return reverse iterators set to the last item and before the first item of the 
+   // lowest level of the SkipList
+   // Parameters: N/A
+   // Preconditions: Initialized SkipList
+   // Postconditions: N/A
+   // Return value: reverse_iterator
+   // Functions called: end, begin
+   reverse_iterator rbegin() const;
+   reverse_iterator rend() const;
+
+   // Function purpose: To return the first item of the SkipList
+   // Parameters: N/A
+   // Preconditions: The SkipList is not empty
+   // Postconditions: N/A
+   // Return value: const reference to the smallest item
+   // Functions called: N/A
+   const T& front() const;
+
+   // Function purpose: To return the last item of the SkipList
+   // Parameters: N/A
+   // Preconditions: The SkipList is not empty
+   // Postconditions: N/A
+   // Return value: const reference to the largest item
+   // Functions called: N/A
+   const T& back() const;
+
+   // Function purpose: To return a copy of the allocator used by the SkipList
+   // Parameters: N/A
+   // Preconditions: Initialized SkipList
+   // Postconditions: N/A
+   // Return value: allocator_type
+   // Functions called: N/A
+   allocator_type get_allocator() const;
+
+   // Function purpose: To return a copy of the comparator used by the SkipList
+   // Parameters: N/A
+   // Preconditions: Initialized SkipList
+   // Postconditions: N/A
+   // Return value: key_compare
+   // Functions called: N/A
+   key_compare key_comp() const;
+
+   // Positional operations, available when Indexed is true (see IndexedSkipList). Each link stores how many 
+   // lowest-level steps it spans, so positions are found by the same logarithmic descent as items.
+
+   // Function purpose: To count the items that are less than a given item
+   // Parameters: An item to search for
+   // Preconditions: Indexed is true
+   // Postconditions: N/A
+   // Return value: int for the 0-based position that data has or would have in the SkipList
+   // Functions called: successor, linkWidth
+   int rank(const T& data) const;
+
+   // Function purpose: To locate the item at a position
+   // Parameters: A 0-based index
+   // Preconditions: Indexed is true
+   // Postconditions: N/A
+   // Return value: iterator to the item, or end() if index is not less than size()
+   // Functions called: findIndex
+   iterator nth(int index) const;
+
+   // Function purpose: To access the item at a position
+   // Parameters: A 0-based index
+   // Preconditions: Indexed is true
+   // Postconditions: N/A
+   // Return value: const reference to the item; throws out_of_range if index is not less than size()
+   // Functions called: findIndex
+   const T& at(int index) const;
+
+   // Function purpose: To remove the item at a position
+   // Parameters: A 0-based index
+   // Preconditions: Indexed is true
+   // Postconditions: The item that was at index is no longer in the SkipList
+   // Return value: int for the number of items removed (0 if index is out of range, otherwise 1)
+   // Functions called: findIndex, unlinkNode
+   int erase_at(int index);
+
+private:
+
+   // Function purpose: To add an item unless an equal item is in the SkipList
+   // Parameters: An item, forwarded so that an rvalue is moved into the new node
+   // Preconditions: Initialized SkipList
+   // Postconditions: The item is in the SkipList; data is left untouched if it already was
+   // Return value: pair of an iterator to the item and a bool that is true if the item was inserted
+   // Functions called: findPredecessors, randomHeight, createNode, linkNode
+   template<class U>
+   pair<iterator, bool> insertUnique(U&& data);
+
 };
 
+// SkipList that also supports rank, nth, at and erase_at in O(log n)
+template<class T, class Compare = less<T>, class Allocator = allocator<T>>
+using IndexedSkipList = SkipList<T, Compare, Allocator, true>;
+
 #include "SkipList.cpp"
\ No newline at end of file
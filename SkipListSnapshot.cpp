@@ -0,0 +1,76 @@
+/*
+SkipListSnapshot.cpp
+*/
+
+// Function purpose: To build the header of a snapshot
+// Parameters: The number of items, the bytes of the item section and the number of levels stored
+// Preconditions: supports<T>()
+// Postconditions: N/A
+// Return value: Header
+// Functions called: keyKind
+template<class T>
+SkipListSnapshot::Header SkipListSnapshot::makeHeader(uint64_t count, uint64_t itemBytes, uint32_t levels) {
+   static_assert(supports<T>(), "snapshots hold trivially copyable items other than pointers, or strings");
+   Header header;
+   memset(&header, 0, sizeof(header));
+   memcpy(header.magic, MAGIC, sizeof(MAGIC));
+   header.version = VERSION;
+   header.byteOrder = BYTE_ORDER_MARK;
+   header.keyKind = keyKind<T>();
+   header.keySize = is_same<T, string>::value ? 0 : static_cast<uint32_t>(sizeof(T));
+   header.levels = levels;
+   header.count = count;
+   header.itemBytes = itemBytes;
+   return header;
+}
+
+// Function purpose: To check that a header belongs to a snapshot of items of type T
+// Parameters: The header and the name of the reader, used in the message of the exception
+// Preconditions: supports<T>()
+// Postconditions: N/A
+// Return value: void; throws runtime_error if the header does not match
+// Functions called: N/A
+template<class T>
+void SkipListSnapshot::checkHeader(const Header& header, const char *reader) {
+   static_assert(supports<T>(), "snapshots hold trivially copyable items other than pointers, or strings");
+   Header expected = makeHeader<T>(0, 0, 1);
+   if (memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+      throw runtime_error(string(reader) + ": not a SkipList snapshot");
+   }
+   if (header.version != VERSION) {
+      throw runtime_error(string(reader) + ": unsupported snapshot version " + to_string(header.version));
+   }
+   if (header.byteOrder != BYTE_ORDER_MARK) {
+      throw runtime_error(string(reader) + ": snapshot was written with another byte order");
+   }
+   if (header.keyKind != expected.keyKind || header.keySize != expected.keySize) {
+      throw runtime_error(string(reader) + ": snapshot holds items of another type");
+   }
+   if (header.levels < 1 || header.levels > MAX_LEVELS || header.itemBytes % 8 != 0) {
+      throw runtime_error(string(reader) + ": corrupt snapshot header");
+   }
+}
+
+// Function purpose: To return the keyKind recorded for a key type
+// Parameters: N/A
+// Preconditions: supports<T>()
+// Postconditions: N/A
+// Return value: uint32_t
+// Functions called: N/A
+template<class T>
+constexpr uint32_t SkipListSnapshot::keyKind() {
+   if (is_same<T, string>::value) { return STRING_KEYS; }
+   if (is_floating_point<T>::value) { return FLOATING_KEYS; }
+   if (is_integral<T>::value) { return is_signed<T>::value ? SIGNED_KEYS : UNSIGNED_KEYS; }
+   return TRIVIAL_KEYS;
+}
+
+// Function purpose: To round a number of bytes up to the next multiple of 8
+// Parameters: The number of bytes
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: uint64_t
+// Functions called: N/A
+inline uint64_t SkipListSnapshot::padded(uint64_t bytes) {
+   return (bytes + 7) & ~uint64_t(7);
+}
@@ -0,0 +1,120 @@
+/*
+SkipListSnapshot.h
+
+Input & output: SkipListSnapshot describes the binary file written by SkipList::save and read back by
+SkipList::load and MappedSkipList. It holds the layout of the file and the checks shared by its readers.
+Program use:
+Included by SkipList.h and MappedSkipList.h; it is not used directly.
+Assumptions:
+A snapshot is read on a machine with the byte order and type sizes of the machine that wrote it; the
+header records both and a mismatch is rejected. Keys are either trivially copyable or std::string, and
+not pointers, whose values mean nothing in another process. The header also records whether arithmetic
+keys are signed integers, unsigned integers or floating point, so an int snapshot is not read as unsigned
+or float items of the same size.
+Description:
+Every section starts at a multiple of 8 bytes, so a file that is mapped into memory can be read in place.
+The file is a Header followed by
+- the items in increasing order: count records of sizeof(T) bytes, or for strings count + 1 uint64_t
+  offsets into the character data that follows them, so item i spans offsets[i] to offsets[i + 1]
+- for each level above the lowest, a uint64_t count followed by that many Links. A Link names the index of
+  an item on the lowest level and the index of the same item on the level below, so a search moves right
+  through a level by advancing one Link and drops a level by following down.
+A snapshot saved without towers has levels = 1 and holds the items only.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+using namespace std;
+
+class SkipListSnapshot {
+
+public:
+
+   static constexpr uint32_t VERSION = 2;
+   static constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+   // keyKind of a header; TRIVIAL_KEYS covers every trivially copyable type that is not arithmetic
+   static constexpr uint32_t TRIVIAL_KEYS = 0;
+   static constexpr uint32_t STRING_KEYS = 1;
+   static constexpr uint32_t SIGNED_KEYS = 2;
+   static constexpr uint32_t UNSIGNED_KEYS = 3;
+   static constexpr uint32_t FLOATING_KEYS = 4;
+   // A SkipList never has more levels than this, so neither may a snapshot
+   static constexpr uint32_t MAX_LEVELS = 32;
+
+   struct Header {
+      char magic[8];
+      uint32_t version;
+      uint32_t byteOrder;
+      uint32_t keyKind;
+      uint32_t keySize;
+      uint32_t levels;
+      uint32_t reserved;
+      uint64_t count;
+      // Bytes of the item section, padding included
+      uint64_t itemBytes;
+   };
+
+   struct Link {
+      uint64_t item;
+      uint64_t down;
+   };
+
+   // Function purpose: To tell whether a key type can be stored in a snapshot
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: bool that is true for string and for trivially copyable types other than pointers
+   // Functions called: N/A
+   template<class T>
+   static constexpr bool supports() {
+      return (is_trivially_copyable<T>::value && !is_pointer<T>::value && !is_member_pointer<T>::value) || 
+         is_same<T, string>::value;
+   }
+
+   // Function purpose: To build the header of a snapshot
+   // Parameters: The number of items, the bytes of the item section and the number of levels stored
+   // Preconditions: supports<T>()
+   // Postconditions: N/A
+   // Return value: Header
+   // Functions called: N/A
+   template<class T>
+   static Header makeHeader(uint64_t count, uint64_t itemBytes, uint32_t levels);
+
+   // Function purpose: To check that a header belongs to a snapshot of items of type T
+   // Parameters: The header and the name of the reader, used in the message of the exception
+   // Preconditions: supports<T>()
+   // Postconditions: N/A
+   // Return value: void; throws runtime_error if the header does not match
+   // Functions called: N/A
+   template<class T>
+   static void checkHeader(const Header& header, const char *reader);
+
+   // Function purpose: To round a number of bytes up to the next multiple of 8
+   // Parameters: The number of bytes
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: uint64_t
+   // Functions called: N/A
+   static uint64_t padded(uint64_t bytes);
+
+private:
+
+   // Function purpose: To return the keyKind recorded for a key type
+   // Parameters: N/A
+   // Preconditions: supports<T>()
+   // Postconditions: N/A
+   // Return value: uint32_t
+   // Functions called: N/A
+   template<class T>
+   static constexpr uint32_t keyKind();
+
+   static constexpr char MAGIC[8] = {'S', 'K', 'P', 'L', 'I', 'S', 'T', '\0'};
+};
+
+#include "SkipListSnapshot.cpp"
@@ -0,0 +1,490 @@
+/*
+SkipMap.cpp
+*/
+
+// Function purpose: To initialize an EntryCompare
+// Parameters: The comparator for keys
+// Preconditions: N/A
+// Postconditions: An initialized EntryCompare
+// Return value: N/A
+// Functions called: N/A
+template<class K, class V, class Compare, class Allocator>
+SkipMap<K, V, Compare, Allocator>::EntryCompare::EntryCompare(const Compare& comp) : comp_(comp) {}
+
+// Function purpose: To compare two entries or keys by key
+// Parameters: Two entries or keys, in any combination
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: bool that is true if the key of lhs is less than the key of rhs
+// Functions called: key
+template<class K, class V, class Compare, class Allocator>
+template<class Lhs, class Rhs>
+bool SkipMap<K, V, Compare, Allocator>::EntryCompare::operator()(const Lhs& lhs, const Rhs& rhs) const {
+   return comp_(key(lhs), key(rhs));
+}
+
+// Function purpose: To return the key of an entry, or a key unchanged
+// Parameters: An entry or a key
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: const reference to the key
+// Functions called: N/A
+template<class K, class V, class Compare, class Allocator>
+const K& SkipMap<K, V, Compare, Allocator>::EntryCompare::key(const value_type& entry) {
+   return entry.first;
+}
+
+template<class K, class V, class Compare, class Allocator>
+template<class Key>
+const Key& SkipMap<K, V, Compare, Allocator>::EntryCompare::key(const Key& key) {
+   return key;
+}
+
+// Function purpose: To construct an iterator for the SkipMap
+// Parameters: A pointer to the SkipList of the SkipMap and a pointer to one of its SkipListNodes
+// Preconditions: N/A
+// Postconditions: Iterator located at the SkipListNode (end() if nullptr)
+// Return value: N/A
+// Functions called: N/A
+template<class K, class V, class Compare, class Allocator>
+template<bool IsConst>
+SkipMap<K, V, Compare, Allocator>::MapIterator<IsConst>::MapIterator(const ListType *listPtr, SkipListNode *nodePtr) 
+   : listPtr_(listPtr), nodePtr_(nodePtr) {}
+
+// Function purpose: To convert an iterator to a const_iterator at the same entry
+// Parameters: An iterator
+// Preconditions: N/A
+// Postconditions: Iterator located at the same entry as the parameter
+// Return value: N/A
+// Functions called: N/A
+template<class K, class V, class Compare, class Allocator>
+template<bool IsConst>
+SkipMap<K, V, Compare, Allocator>::MapIterator<IsConst>::MapIterator(const MapIterator<false>& other)
+   : listPtr_(other.listPtr_), nodePtr_(other.nodePtr_) {}
+
+// Function purpose: To return the entry stored in nodePtr_
+// Parameters: N/A
+// Preconditions: The iterator is not at end()
+// Postconditions: N/A
+// Return value: reference to the entry
+// Functions called: N/A
+template<class K, class V, class Compare, class Allocator>
+template<bool IsConst>
+typename SkipMap<K, V, Compare, Allocator>::template MapIterator<IsConst>::reference
+SkipMap<K, V, Compare, Allocator>::MapIterator<IsConst>::operator*() const {
+   return nodePtr_->data_;
+}
+
+template<class K, class V, class Compare, class Allocator>
+template<bool IsConst>
+typename SkipMap<K, V, Compare, Allocator>::template MapIterator<IsConst>::pointer
+SkipMap<K, V, Compare, Allocator>::MapIterator<IsConst>::operator->() const {
+   return &nodePtr_->data_;
+}
+
+// Function purpose: To increment the iterator to the next entry (prefix incrementation)
+// Parameters: N/A
+// Preconditions: The iterator is not at end()
+// Postconditions: Incremented iterator
+// Return value: iterator reference
+// Functions called: N/A
+template<class K, class V, class Compare, class Allocator>
+template<bool IsConst>
+typename SkipMap<K, V, Compare, Allocator>::template MapIterator<IsConst>&
+SkipMap<K, V, Compare, Allocator>::MapIterator<IsConst>::operator++() {
+   nodePtr_ = nodePtr_->next(0);
+   return (*this);
+}
+
+// Function purpose: To return the current iterator, then increment it (postfix incrementation)
+// Parameters: N/A
+// Preconditions: The iterator is not at end()
+// Postconditions: Iterator located at the current position of iterator before it was incremented
+// Return value: iterator
+// Functions called: N/A
+template<class K, class V, class Compare, class Allocator>
+template<bool IsConst>
+typename SkipMap<K, V, Compare, Allocator>::template MapIterator<IsConst>
+SkipMap<K, V, Compare, Allocator>::MapIterator<IsConst>::operator++(int) {
+   MapIterator temp = *this;
+   ++(*this);
+   return temp;
+}
+
+// Function purpose: To decrement the iterator to the previous entry (prefix decrementation)
+// Parameters: N/A
+// Preconditions: The iterator is not at begin()
+// Postconditions: Decremented iterator; end() moves to the last entry
+// Return value: iterator reference
+// Functions called: N/A
+template<class K, class V, class Compare, class Allocator>
+template<bool IsConst>
+typename SkipMap<K, V, Compare, Allocator>::template MapIterator<IsConst>&
+SkipMap<K, V, Compare, Allocator>::MapIterator<IsConst>::operator--() {
+   nodePtr_ = (nodePtr_ == nullptr) ? listPtr_->tails_[0] : nodePtr_->prev_;
+   return (*this);
+}
+
+// Function purpose: To return the current iterator, then decrement it (postfix decrementation)
+// Parameters: N/A
+// Preconditions: The iterator is not at begin()
+// Postconditions: Iterator located at the current position of iterator before it was decremented
+// Return value: iterator
+// Functions called: N/A
+template<class K, class V, class Compare, class Allocator>
+template<bool IsConst>
+typename SkipMap<K, V, Compare, Allocator>::template MapIterator<IsConst>
+SkipMap<K, V, Compare, Allocator>::MapIterator<IsConst>::operator--(int) {
+   MapIterator temp = *this;
+   --(*this);
+   return temp;
+}
+
+// Function purpose: To determine whether two iterators are at the same entry (equal)
+// Parameters: An iterator
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: bool
+// Functions called: N/A
+template<class K, class V, class Compare, class Allocator>
+template<bool IsConst>
+bool SkipMap<K, V, Compare, Allocator>::MapIterator<IsConst>::operator==(const MapIterator& rhs) const {
+   return nodePtr_ == rhs.nodePtr_;
+}
+
+template<class K, class V, class Compare, class Allocator>
+template<bool IsConst>
+bool SkipMap<K, V, Compare, Allocator>::MapIterator<IsConst>::operator!=(const MapIterator& rhs) const {
+   return nodePtr_ != rhs.nodePtr_;
+}
+
+// Function purpose: To initialize an empty SkipMap
+// Parameters: The comparator for keys and the allocator used for entries
+// Preconditions: N/A
+// Postconditions: An initialized SkipMap
+// Return value: N/A
+// Functions called: N/A
+template<class K, class V, class Compare, class Allocator>
+SkipMap<K, V, Compare, Allocator>::SkipMap(const Compare& comp, const Allocator& alloc)
+   : list_(1, EntryCompare(comp), alloc) {}
+
+// Function purpose: To initialize a SkipMap using initializer_list
+// Parameters: An initialization list of entries, the comparator for keys and the allocator used for entries
+// Preconditions: N/A
+// Postconditions: A SkipMap holding the first entry given for each key
+// Return value: N/A
+// Functions called: SkipList::insert_range
+template<class K, class V, class Compare, class Allocator>
+SkipMap<K, V, Compare, Allocator>::SkipMap(initializer_list<value_type> vals, const Compare& comp,
+      const Allocator& alloc) : list_(1, EntryCompare(comp), alloc) {
+   list_.insert_range(vals.begin(), vals.end());
+}
+
+// Function purpose: To add an entry for a key that is not in the SkipMap
+// Parameters: The key and the arguments of the constructor of V
+// Preconditions: Initialized SkipMap
+// Postconditions: The key is in the SkipMap; args are left untouched if it already was
+// Return value: pair of the node of the entry and a bool that is true if the entry was inserted
+// Functions called: SkipList::findPredecessors, SkipList::createNode, SkipList::linkNode
+template<class K, class V, class Compare, class Allocator>
+template<class KeyArg, class... Args>
+pair<typename SkipMap<K, V, Compare, Allocator>::SkipListNode*, bool>
+SkipMap<K, V, Compare, Allocator>::emplaceKey(KeyArg&& key, Args&&... args) {
+   typename ListType::SearchPath beforeNodes(list_.maxLevel_);
+   SkipListNode *found = list_.findPredecessors(key, beforeNodes);
+   if (found != nullptr && !list_.comp_(key, found->data_)) {
+      return make_pair(found, false);
+   }
+   // The entry is only built once the key is known to be absent, directly inside the new node
+   SkipListNode *newValue = list_.createNode(list_.randomHeight(), piecewise_construct,
+      forward_as_tuple(std::forward<KeyArg>(key)), forward_as_tuple(std::forward<Args>(args)...));
+   list_.linkNode(newValue, beforeNodes);
+   return make_pair(newValue, true);
+}
+
+// Function purpose: To access the value of a key, inserting a default-constructed value if it is absent
+// Parameters: The key
+// Preconditions: V is default constructible
+// Postconditions: The key is in the SkipMap
+// Return value: reference to the value
+// Functions called: emplaceKey
+template<class K, class V, class Compare, class Allocator>
+V& SkipMap<K, V, Compare, Allocator>::operator[](const K& key) {
+   return emplaceKey(key).first->data_.second;
+}
+
+template<class K, class V, class Compare, class Allocator>
+V& SkipMap<K, V, Compare, Allocator>::operator[](K&& key) {
+   return emplaceKey(std::move(key)).first->data_.second;
+}
+
+// Function purpose: To access the value of a key that is in the SkipMap
+// Parameters: The key
+// Preconditions: Initialized SkipMap
+// Postconditions: N/A
+// Return value: reference to the value; throws out_of_range if the key is absent
+// Functions called: SkipList::lowerBoundNode
+template<class K, class V, class Compare, class Allocator>
+V& SkipMap<K, V, Compare, Allocator>::at(const K& key) {
+   SkipListNode *curr = list_.lowerBoundNode(key);
+   if (curr == nullptr || list_.comp_(key, curr->data_)) {
+      throw out_of_range("SkipMap::at: key is not in the SkipMap");
+   }
+   return curr->data_.second;
+}
+
+template<class K, class V, class Compare, class Allocator>
+const V& SkipMap<K, V, Compare, Allocator>::at(const K& key) const {
+   SkipListNode *curr = list_.lowerBoundNode(key);
+   if (curr == nullptr || list_.comp_(key, curr->data_)) {
+      throw out_of_range("SkipMap::at: key is not in the SkipMap");
+   }
+   return curr->data_.second;
+}
+
+// Function purpose: To add an entry whose value is constructed in place, unless the key is present
+// Parameters: The key and the arguments of the constructor of V
+// Preconditions: Initialized SkipMap
+// Postconditions: The key is in the SkipMap; the arguments are not used if it already was
+// Return value: pair of an iterator to the entry and a bool that is true if the entry was inserted
+// Functions called: emplaceKey
+template<class K, class V, class Compare, class Allocator>
+template<class... Args>
+pair<typename SkipMap<K, V, Compare, Allocator>::iterator, bool>
+SkipMap<K, V, Compare, Allocator>::try_emplace(const K& key, Args&&... args) {
+   pair<SkipListNode*, bool> result = emplaceKey(key, std::forward<Args>(args)...);
+   return make_pair(iterator(&list_, result.first), result.second);
+}
+
+template<class K, class V, class Compare, class Allocator>
+template<class... Args>
+pair<typename SkipMap<K, V, Compare, Allocator>::iterator, bool>
+SkipMap<K, V, Compare, Allocator>::try_emplace(K&& key, Args&&... args) {
+   pair<SkipListNode*, bool> result = emplaceKey(std::move(key), std::forward<Args>(args)...);
+   return make_pair(iterator(&list_, result.first), result.second);
+}
+
+// Function purpose: To add an entry, or assign a new value to the entry of a key that is present
+// Parameters: The key and the value
+// Preconditions: V is assignable from M
+// Postconditions: The key is in the SkipMap with the given value
+// Return value: pair of an iterator to the entry and a bool that is true if the entry was inserted
+// Functions called: emplaceKey
+template<class K, class V, class Compare, class Allocator>
+template<class M>
+pair<typename SkipMap<K, V, Compare, Allocator>::iterator, bool>
+SkipMap<K, V, Compare, Allocator>::insert_or_assign(const K& key, M&& value) {
+   pair<SkipListNode*, bool> result = emplaceKey(key, std::forward<M>(value));
+   // emplaceKey leaves value untouched when the key is present, so it can still be assigned here
+   if (!result.second) { result.first->data_.second = std::forward<M>(value); }
+   return make_pair(iterator(&list_, result.first), result.second);
+}
+
+template<class K, class V, class Compare, class Allocator>
+template<class M>
+pair<typename SkipMap<K, V, Compare, Allocator>::iterator, bool>
+SkipMap<K, V, Compare, Allocator>::insert_or_assign(K&& key, M&& value) {
+   pair<SkipListNode*, bool> result = emplaceKey(std::move(key), std::forward<M>(value));
+   if (!result.second) { result.first->data_.second = std::forward<M>(value); }
+   return make_pair(iterator(&list_, result.first), result.second);
+}
+
+// Function purpose: To add a copy of an entry unless its key is present
+// Parameters: An entry
+// Preconditions: Initialized SkipMap
+// Postconditions: The key of the entry is in the SkipMap
+// Return value: pair of an iterator to the entry and a bool that is true if the entry was inserted
+// Functions called: emplaceKey
+template<class K, class V, class Compare, class Allocator>
+pair<typename SkipMap<K, V, Compare, Allocator>::iterator, bool>
+SkipMap<K, V, Compare, Allocator>::insert(const value_type& entry) {
+   pair<SkipListNode*, bool> result = emplaceKey(entry.first, entry.second);
+   return make_pair(iterator(&list_, result.first), result.second);
+}
+
+// Function purpose: To remove the entry of a key
+// Parameters: The key
+// Preconditions: Initialized SkipMap
+// Postconditions: The key is no longer in the SkipMap
+// Return value: int for the number of entries removed (0 or 1)
+// Functions called: SkipList::findPredecessors, SkipList::unlinkNode
+template<class K, class V, class Compare, class Allocator>
+int SkipMap<K, V, Compare, Allocator>::erase(const K& key) {
+   typename ListType::SearchPath beforeNodes(list_.maxLevel_);
+   SkipListNode *found = list_.findPredecessors(key, beforeNodes);
+   if (found == nullptr || list_.comp_(key, found->data_)) { return 0; }
+   list_.unlinkNode(found, beforeNodes);
+   return 1;
+}
+
+// Function purpose: To check if the SkipMap contains a key
+// Parameters: The key
+// Preconditions: Initialized SkipMap
+// Postconditions: N/A
+// Return value: bool
+// Functions called: SkipList::contains
+template<class K, class V, class Compare, class Allocator>
+bool SkipMap<K, V, Compare, Allocator>::contains(const K& key) const {
+   return list_.contains(key);
+}
+
+// Function purpose: To locate the entry of a key
+// Parameters: The key
+// Preconditions: Initialized SkipMap
+// Postconditions: N/A
+// Return value: iterator to the entry, or end() if the key is absent
+// Functions called: SkipList::lowerBoundNode
+template<class K, class V, class Compare, class Allocator>
+typename SkipMap<K, V, Compare, Allocator>::iterator SkipMap<K, V, Compare, Allocator>::find(const K& key) {
+   SkipListNode *curr = list_.lowerBoundNode(key);
+   if (curr != nullptr && list_.comp_(key, curr->data_)) { curr = nullptr; }
+   return iterator(&list_, curr);
+}
+
+template<class K, class V, class Compare, class Allocator>
+typename SkipMap<K, V, Compare, Allocator>::const_iterator SkipMap<K, V, Compare, Allocator>::find(const K& key) const {
+   SkipListNode *curr = list_.lowerBoundNode(key);
+   if (curr != nullptr && list_.comp_(key, curr->data_)) { curr = nullptr; }
+   return const_iterator(&list_, curr);
+}
+
+// Function purpose: To locate the first entry whose key is not less than a key
+// Parameters: The key
+// Preconditions: Initialized SkipMap
+// Postconditions: N/A
+// Return value: iterator, or end() if every key is less than key
+// Functions called: SkipList::lowerBoundNode
+template<class K, class V, class Compare, class Allocator>
+typename SkipMap<K, V, Compare, Allocator>::iterator SkipMap<K, V, Compare, Allocator>::lower_bound(const K& key) {
+   return iterator(&list_, list_.lowerBoundNode(key));
+}
+
+template<class K, class V, class Compare, class Allocator>
+typename SkipMap<K, V, Compare, Allocator>::const_iterator
+SkipMap<K, V, Compare, Allocator>::lower_bound(const K& key) const {
+   return const_iterator(&list_, list_.lowerBoundNode(key));
+}
+
+// Function purpose: To locate the first entry whose key is greater than a key
+// Parameters: The key
+// Preconditions: Initialized SkipMap
+// Postconditions: N/A
+// Return value: iterator, or end() if no key is greater than key
+// Functions called: SkipList::upperBoundNode
+template<class K, class V, class Compare, class Allocator>
+typename SkipMap<K, V, Compare, Allocator>::iterator SkipMap<K, V, Compare, Allocator>::upper_bound(const K& key) {
+   return iterator(&list_, list_.upperBoundNode(key));
+}
+
+template<class K, class V, class Compare, class Allocator>
+typename SkipMap<K, V, Compare, Allocator>::const_iterator
+SkipMap<K, V, Compare, Allocator>::upper_bound(const K& key) const {
+   return const_iterator(&list_, list_.upperBoundNode(key));
+}
+
+// Function purpose: To return the number of entries in the SkipMap
+// Parameters: N/A
+// Preconditions: Initialized SkipMap
+// Postconditions: N/A
+// Return value: int
+// Functions called: SkipList::size
+template<class K, class V, class Compare, class Allocator>
+int SkipMap<K, V, Compare, Allocator>::size() const {
+   return list_.size();
+}
+
+// Function purpose: To indicate whether the SkipMap is empty
+// Parameters: N/A
+// Preconditions: Initialized SkipMap
+// Postconditions: N/A
+// Return value: bool
+// Functions called: SkipList::empty
+template<class K, class V, class Compare, class Allocator>
+bool SkipMap<K, V, Compare, Allocator>::empty() const {
+   return list_.empty();
+}
+
+// Function purpose: To remove every entry of the SkipMap
+// Parameters: N/A
+// Preconditions: Initialized SkipMap
+// Postconditions: Empty SkipMap
+// Return value: void
+// Functions called: SkipList::clear
+template<class K, class V, class Compare, class Allocator>
+void SkipMap<K, V, Compare, Allocator>::clear() {
+   list_.clear();
+}
+
+// Function purpose: To return iterators to the first entry and past the last entry
+// Parameters: N/A
+// Preconditions: Initialized SkipMap
+// Postconditions: N/A
+// Return value: iterator
+// Functions called: N/A
+template<class K, class V, class Compare, class Allocator>
+typename SkipMap<K, V, Compare, Allocator>::iterator SkipMap<K, V, Compare, Allocator>::begin() {
+   return iterator(&list_, list_.heads_[0]);
+}
+
+template<class K, class V, class Compare, class Allocator>
+typename SkipMap<K, V, Compare, Allocator>::iterator SkipMap<K, V, Compare, Allocator>::end() {
+   return iterator(&list_, nullptr);
+}
+
+template<class K, class V, class Compare, class Allocator>
+typename SkipMap<K, V, Compare, Allocator>::const_iterator SkipMap<K, V, Compare, Allocator>::begin() const {
+   return const_iterator(&list_, list_.heads_[0]);
+}
+
+template<class K, class V, class Compare, class Allocator>
+typename SkipMap<K, V, Compare, Allocator>::const_iterator SkipMap<K, V, Compare, Allocator>::end() const {
+   return const_iterator(&list_, nullptr);
+}
+
+// Function purpose: To return reverse iterators to the last entry and before the first entry
+// Parameters: N/A
+// Preconditions: Initialized SkipMap
+// Postconditions: N/A
+// Return value: reverse_iterator
+// Functions called: end, begin
+template<class K, class V, class Compare, class Allocator>
+typename SkipMap<K, V, Compare, Allocator>::reverse_iterator SkipMap<K, V, Compare, Allocator>::rbegin() {
+   return reverse_iterator(end());
+}
+
+template<class K, class V, class Compare, class Allocator>
+typename SkipMap<K, V, Compare, Allocator>::reverse_iterator SkipMap<K, V, Compare, Allocator>::rend() {
+   return reverse_iterator(begin());
+}
+
+template<class K, class V, class Compare, class Allocator>
+typename SkipMap<K, V, Compare, Allocator>::const_reverse_iterator SkipMap<K, V, Compare, Allocator>::rbegin() const {
+   return const_reverse_iterator(end());
+}
+
+template<class K, class V, class Compare, class Allocator>
+typename SkipMap<K, V, Compare, Allocator>::const_reverse_iterator SkipMap<K, V, Compare, Allocator>::rend() const {
+   return const_reverse_iterator(begin());
+}
+
+// Function purpose: To return a copy of the comparator for keys
+// Parameters: N/A
+// Preconditions: Initialized SkipMap
+// Postconditions: N/A
+// Return value: key_compare
+// Functions called: N/A
+template<class K, class V, class Compare, class Allocator>
+typename SkipMap<K, V, Compare, Allocator>::key_compare SkipMap<K, V, Compare, Allocator>::key_comp() const {
+   return list_.comp_.comp_;
+}
+
+// Function purpose: To return a copy of the allocator used for entries
+// Parameters: N/A
+// Preconditions: Initialized SkipMap
+// Postconditions: N/A
+// Return value: allocator_type
+// Functions called: SkipList::get_allocator
+template<class K, class V, class Compare, class Allocator>
+typename SkipMap<K, V, Compare, Allocator>::allocator_type SkipMap<K, V, Compare, Allocator>::get_allocator() const {
+   return list_.get_allocator();
+}
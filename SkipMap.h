@@ -0,0 +1,357 @@
+/*
+SkipMap.h
+
+Input & output: SkipMap<K, V> is an ordered map from unique keys to values. Each entry is a
+pair<const K, V> that is stored inline in a single SkipList node, so a lookup, insertion or removal is one
+descent of the SkipList and no second container is needed for the values.
+Program use:
+Include SkipMap.h. SkipMap<string, int> objectName; objectName["key"] = 1;
+try_emplace(key, args...) constructs the value from args only if the key is absent, and
+insert_or_assign(key, value) inserts the entry or assigns the value of an existing one. Both return a
+pair of an iterator to the entry and a bool that is true if it was inserted. find, lower_bound and
+upper_bound locate entries by key, and iteration visits the entries in increasing order of key. Iterators
+are bidirectional, so rbegin() and rend() walk the entries from the largest key down. The value of an entry
+may be modified through an iterator; its key may not.
+Like SkipList, SkipMap takes an optional Compare for the keys (less<K> by default) and an Allocator for the
+entries (allocator<pair<const K, V>> by default), e.g. SkipMap<int, int, less<int>,
+PoolAllocator<pair<const int, int>>> objectName;
+Assumptions:
+Compare is a strict weak ordering on K. operator[] requires V to be default constructible.
+Description:
+A SkipMap owns a SkipList of entries whose comparator orders an entry by its key and can also compare an
+entry directly against a bare key. The map searches that SkipList with the key itself and builds the entry
+in the new node only after the search has shown that the key is absent, so a key that is already present
+costs no allocation and no copy of the value.
+*/
+
+#pragma once
+
+#include "SkipList.h"
+#include <tuple>
+#include <stdexcept>
+
+using namespace std;
+
+template<class K, class V, class Compare = less<K>, class Allocator = allocator<pair<const K, V>>>
+class SkipMap {
+
+public:
+
+   using key_type = K;
+   using mapped_type = V;
+   using value_type = pair<const K, V>;
+   using key_compare = Compare;
+   using allocator_type = Allocator;
+
+private:
+
+   // Orders entries by key and compares entries against bare keys, so the SkipList can be searched by key
+   struct EntryCompare {
+      using is_transparent = void;
+
+      // Function purpose: To initialize an EntryCompare
+      // Parameters: The comparator for keys
+      // Preconditions: N/A
+      // Postconditions: An initialized EntryCompare
+      // Return value: N/A
+      // Functions called: N/A
+      explicit EntryCompare(const Compare& comp = Compare());
+
+      // Function purpose: To compare two entries or keys by key
+      // Parameters: Two entries or keys, in any combination
+      // Preconditions: N/A
+      // Postconditions: N/A
+      // Return value: bool that is true if the key of lhs is less than the key of rhs
+      // Functions called: key
+      template<class Lhs, class Rhs>
+      bool operator()(const Lhs& lhs, const Rhs& rhs) const;
+
+      // Function purpose: To return the key of an entry, or a key unchanged
+      // Parameters: An entry or a key
+      // Preconditions: N/A
+      // Postconditions: N/A
+      // Return value: const reference to the key
+      // Functions called: N/A
+      static const K& key(const value_type& entry);
+      template<class Key>
+      static const Key& key(const Key& key);
+
+      Compare comp_;
+   };
+
+   using ListType = SkipList<value_type, EntryCompare, Allocator>;
+   using SkipListNode = typename ListType::SkipListNode;
+
+   ListType list_;
+
+   // Function purpose: To add an entry for a key that is not in the SkipMap
+   // Parameters: The key and the arguments of the constructor of V
+   // Preconditions: Initialized SkipMap
+   // Postconditions: The key is in the SkipMap; args are left untouched if it already was
+   // Return value: pair of an iterator to the entry and a bool that is true if the entry was inserted
+   // Functions called: SkipList::findPredecessors, SkipList::createNode, SkipList::linkNode
+   template<class KeyArg, class... Args>
+   pair<SkipListNode*, bool> emplaceKey(KeyArg&& key, Args&&... args);
+
+public:
+
+   template<bool IsConst>
+   class MapIterator {
+      public:
+      using iterator_category = std::bidirectional_iterator_tag;
+      using difference_type = std::ptrdiff_t;
+      using value_type = typename SkipMap::value_type;
+      using pointer = typename conditional<IsConst, const value_type*, value_type*>::type;
+      using reference = typename conditional<IsConst, const value_type&, value_type&>::type;
+
+      // Function purpose: To construct an iterator for the SkipMap
+      // Parameters: A pointer to the SkipList of the SkipMap and a pointer to one of its SkipListNodes
+      // Preconditions: N/A
+      // Postconditions: Iterator located at the SkipListNode (end() if nullptr)
+      // Return value: N/A
+      // Functions called: N/A
+      explicit MapIterator(const ListType *listPtr = nullptr, SkipListNode *nodePtr = nullptr);
+
+      // Function purpose: To convert an iterator to a const_iterator at the same entry
+      // Parameters: An iterator
+      // Preconditions: N/A
+      // Postconditions: Iterator located at the same entry as the parameter
+      // Return value: N/A
+      // Functions called: N/A
+      MapIterator(const MapIterator<false>& other);
+
+      // Function purpose: To return the entry stored in nodePtr_
+      // Parameters: N/A
+      // Preconditions: The iterator is not at end()
+      // Postconditions: N/A
+      // Return value: reference to the entry
+      // Functions called: N/A
+      reference operator*() const;
+      pointer operator->() const;
+
+      // Function purpose: To increment the iterator to the next entry (prefix incrementation)
+      // Parameters: N/A
+      // Preconditions: The iterator is not at end()
+      // Postconditions: Incremented iterator
+      // Return value: iterator reference
+      // Functions called: N/A
+      MapIterator& operator++();
+
+      // Function purpose: To return the current iterator, then increment it (postfix incrementation)
+      // Parameters: N/A
+      // Preconditions: The iterator is not at end()
+      // Postconditions: Iterator located at the current position of iterator before it was incremented
+      // Return value: iterator
+      // Functions called: N/A
+      MapIterator operator++(int);
+
+      // Function purpose: To decrement the iterator to the previous entry (prefix decrementation)
+      // Parameters: N/A
+      // Preconditions: The iterator is not at begin()
+      // Postconditions: Decremented iterator; end() moves to the last entry
+      // Return value: iterator reference
+      // Functions called: N/A
+      MapIterator& operator--();
+
+      // Function purpose: To return the current iterator, then decrement it (postfix decrementation)
+      // Parameters: N/A
+      // Preconditions: The iterator is not at begin()
+      // Postconditions: Iterator located at the current position of iterator before it was decremented
+      // Return value: iterator
+      // Functions called: N/A
+      MapIterator operator--(int);
+
+      // Function purpose: To determine whether two iterators are at the same entry (equal)
+      // Parameters: An iterator
+      // Preconditions: N/A
+      // Postconditions: N/A
+      // Return value: bool
+      // Functions called: N/A
+      bool operator==(const MapIterator& rhs) const;
+      bool operator!=(const MapIterator& rhs) const;
+
+      private:
+      friend class SkipMap;
+      friend class MapIterator<!IsConst>;
+      const ListType *listPtr_;
+      SkipListNode *nodePtr_;
+   };
+
+   using iterator = MapIterator<false>;
+   using const_iterator = MapIterator<true>;
+   using reverse_iterator = std::reverse_iterator<iterator>;
+   using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+   // Function purpose: To initialize an empty SkipMap
+   // Parameters: The comparator for keys and the allocator used for entries
+   // Preconditions: N/A
+   // Postconditions: An initialized SkipMap
+   // Return value: N/A
+   // Functions called: N/A
+   explicit SkipMap(const Compare& comp = Compare(), const Allocator& alloc = Allocator());
+
+   // Function purpose: To initialize a SkipMap using initializer_list
+   // Parameters: An initialization list of entries, the comparator for keys and the allocator used for entries
+   // Preconditions: N/A
+   // Postconditions: A SkipMap holding the first entry given for each key
+   // Return value: N/A
+   // Functions called: SkipList::insert_range
+   SkipMap(initializer_list<value_type> vals, const Compare& comp = Compare(),
+      const Allocator& alloc = Allocator());
+
+   // Function purpose: To access the value of a key, inserting a default-constructed value if it is absent
+   // Parameters: The key
+   // Preconditions: V is default constructible
+   // Postconditions: The key is in the SkipMap
+   // Return value: reference to the value
+   // Functions called: emplaceKey
+   V& operator[](const K& key);
+   V& operator[](K&& key);
+
+   // Function purpose: To access the value of a key that is in the SkipMap
+   // Parameters: The key
+   // Preconditions: Initialized SkipMap
+   // Postconditions: N/A
+   // Return value: reference to the value; throws out_of_range if the key is absent
+   // Functions called: SkipList::lowerBoundNode
+   V& at(const K& key);
+   const V& at(const K& key) const;
+
+   // Function purpose: To add an entry whose value is constructed in place, unless the key is present
+   // Parameters: The key and the arguments of the constructor of V
+   // Preconditions: Initialized SkipMap
+   // Postconditions: The key is in the SkipMap; the arguments are not used if it already was
+   // Return value: pair of an iterator to the entry and a bool that is true if the entry was inserted
+   // Functions called: emplaceKey
+   template<class... Args>
+   pair<iterator, bool> try_emplace(const K& key, Args&&... args);
+   template<class... Args>
+   pair<iterator, bool> try_emplace(K&& key, Args&&... args);
+
+   // Function purpose: To add an entry, or assign a new value to the entry of a key that is present
+   // Parameters: The key and the value
+   // Preconditions: V is assignable from M
+   // Postconditions: The key is in the SkipMap with the given value
+   // Return value: pair of an iterator to the entry and a bool that is true if the entry was inserted
+   // Functions called: emplaceKey
+   template<class M>
+   pair<iterator, bool> insert_or_assign(const K& key, M&& value);
+   template<class M>
+   pair<iterator, bool> insert_or_assign(K&& key, M&& value);
+
+   // Function purpose: To add a copy of an entry unless its key is present
+   // Parameters: An entry
+   // Preconditions: Initialized SkipMap
+   // Postconditions: The key of the entry is in the SkipMap
+   // Return value: pair of an iterator to the entry and a bool that is true if the entry was inserted
+   // Functions called: emplaceKey
+   pair<iterator, bool> insert(const value_type& entry);
+
+   // Function purpose: To remove the entry of a key
+   // Parameters: The key
+   // Preconditions: Initialized SkipMap
+   // Postconditions: The key is no longer in the SkipMap
+   // Return value: int for the number of entries removed (0 or 1)
+   // Functions called: SkipList::findPredecessors, SkipList::unlinkNode
+   int erase(const K& key);
+
+   // Function purpose: To check if the SkipMap contains a key
+   // Parameters: The key
+   // Preconditions: Initialized SkipMap
+   // Postconditions: N/A
+   // Return value: bool
+   // Functions called: SkipList::contains
+   bool contains(const K& key) const;
+
+   // Function purpose: To locate the entry of a key
+   // Parameters: The key
+   // Preconditions: Initialized SkipMap
+   // Postconditions: N/A
+   // Return value: iterator to the entry, or end() if the key is absent
+   // Functions called: SkipList::lowerBoundNode
+   iterator find(const K& key);
+   const_iterator find(const K& key) const;
+
+   // Function purpose: To locate the first entry whose key is not less than a key
+   // Parameters: The key
+   // Preconditions: Initialized SkipMap
+   // Postconditions: N/A
+   // Return value: iterator, or end() if every key is less than key
+   // Functions called: SkipList::lowerBoundNode
+   iterator lower_bound(const K& key);
+   const_iterator lower_bound(const K& key) const;
+
+   // Function purpose: To locate the first entry whose key is greater than a key
+   // Parameters: The key
+   // Preconditions: Initialized SkipMap
+   // Postconditions: N/A
+   // Return value: iterator, or end() if no key is greater than key
+   // Functions called: SkipList::upperBoundNode
+   iterator upper_bound(const K& key);
+   const_iterator upper_bound(const K& key) const;
+
+   // Function purpose: To return the number of entries in the SkipMap
+   // Parameters: N/A
+   // Preconditions: Initialized SkipMap
+   // Postconditions: N/A
+   // Return value: int
+   // Functions called: SkipList::size
+   int size() const;
+
+   // Function purpose: To indicate whether the SkipMap is empty
+   // Parameters: N/A
+   // Preconditions: Initialized SkipMap
+   // Postconditions: N/A
+   // Return value: bool
+   // Functions called: SkipList::empty
+   bool empty() const;
+
+   // Function purpose: To remove every entry of the SkipMap
+   // Parameters: N/A
+   // Preconditions: Initialized SkipMap
+   // Postconditions: Empty SkipMap
+   // Return value: void
+   // Functions called: SkipList::clear
+   void clear();
+
+   // Function purpose: To return iterators to the first entry and past the last entry
+   // Parameters: N/A
+   // Preconditions: Initialized SkipMap
+   // Postconditions: N/A
+   // Return value: iterator
+   // Functions called: N/A
+   iterator begin();
+   iterator end();
+   const_iterator begin() const;
+   const_iterator end() const;
+
+   // Function purpose: To return reverse iterators to the last entry and before the first entry
+   // Parameters: N/A
+   // Preconditions: Initialized SkipMap
+   // Postconditions: N/A
+   // Return value: reverse_iterator
+   // Functions called: end, begin
+   reverse_iterator rbegin();
+   reverse_iterator rend();
+   const_reverse_iterator rbegin() const;
+   const_reverse_iterator rend() const;
+
+   // Function purpose: To return a copy of the comparator for keys
+   // Parameters: N/A
+   // Preconditions: Initialized SkipMap
+   // Postconditions: N/A
+   // Return value: key_compare
+   // Functions called: N/A
+   key_compare key_comp() const;
+
+   // Function purpose: To return a copy of the allocator used for entries
+   // Parameters: N/A
+   // Preconditions: Initialized SkipMap
+   // Postconditions: N/A
+   // Return value: allocator_type
+   // Functions called: SkipList::get_allocator
+   allocator_type get_allocator() const;
+
+};
+
+#include "SkipMap.cpp"
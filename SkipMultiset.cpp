@@ -0,0 +1,308 @@
+/*
+SkipMultiset.cpp
+*/
+
+// Function purpose: To add an item after every item equal to it
+// Parameters: An item, forwarded so that an rvalue is moved into the new node
+// Preconditions: Initialized SkipMultiset
+// Postconditions: The item is in the SkipMultiset, after the items equal to it
+// Return value: The new SkipListNode pointer
+// Functions called: SkipList::findUpperPredecessors, SkipList::createNode, SkipList::linkNode, linkLast
+template<class T, class Compare, class Allocator>
+template<class U>
+typename SkipMultiset<T, Compare, Allocator>::SkipListNode* SkipMultiset<T, Compare, Allocator>::insertEqual(U&& data) {
+   SkipListNode *last = list_.tails_[0];
+   if (last == nullptr || !list_.comp_(data, last->data_)) {
+      // Nothing is greater than data, so its place is at the end and no search is needed
+      SkipListNode *newValue = list_.createNode(list_.randomHeight(), std::forward<U>(data));
+      linkLast(newValue);
+      return newValue;
+   }
+   typename ListType::SearchPath beforeNodes(list_.maxLevel_);
+   list_.findUpperPredecessors(data, beforeNodes);
+   SkipListNode *newValue = list_.createNode(list_.randomHeight(), std::forward<U>(data));
+   list_.linkNode(newValue, beforeNodes);
+   return newValue;
+}
+
+// Function purpose: To link a new node after the last node of the SkipMultiset
+// Parameters: The new SkipListNode pointer
+// Preconditions: The SkipMultiset is empty or its last item is not greater than the item of newValue
+// Postconditions: The item of newValue is the last item of the SkipMultiset
+// Return value: void
+// Functions called: SkipList::appendLinked, SkipList::growIfNeeded
+template<class T, class Compare, class Allocator>
+void SkipMultiset<T, Compare, Allocator>::linkLast(SkipListNode *newValue) {
+   list_.appendLinked(newValue);
+   list_.growIfNeeded();
+}
+
+// Function purpose: To initialize an empty SkipMultiset
+// Parameters: The comparator and the allocator used for items
+// Preconditions: N/A
+// Postconditions: An initialized SkipMultiset
+// Return value: N/A
+// Functions called: N/A
+template<class T, class Compare, class Allocator>
+SkipMultiset<T, Compare, Allocator>::SkipMultiset(const Compare& comp, const Allocator& alloc) : list_(1, comp, alloc) {}
+
+// Function purpose: To initialize a SkipMultiset using initializer_list
+// Parameters: An initialization list of items, the comparator and the allocator used for items
+// Preconditions: N/A
+// Postconditions: A SkipMultiset holding every item of the list
+// Return value: N/A
+// Functions called: insert
+template<class T, class Compare, class Allocator>
+SkipMultiset<T, Compare, Allocator>::SkipMultiset(initializer_list<T> vals, const Compare& comp, const Allocator& alloc)
+   : list_(1, comp, alloc) {
+   insert(vals.begin(), vals.end());
+}
+
+// Function purpose: To add an item, whether or not equal items are present
+// Parameters: An item to copy or move into a new node
+// Preconditions: Initialized SkipMultiset
+// Postconditions: The item is in the SkipMultiset, after the items equal to it
+// Return value: iterator to the new item
+// Functions called: insertEqual
+template<class T, class Compare, class Allocator>
+typename SkipMultiset<T, Compare, Allocator>::iterator SkipMultiset<T, Compare, Allocator>::insert(const T& data) {
+   return iterator(&list_, insertEqual(data));
+}
+
+template<class T, class Compare, class Allocator>
+typename SkipMultiset<T, Compare, Allocator>::iterator SkipMultiset<T, Compare, Allocator>::insert(T&& data) {
+   return iterator(&list_, insertEqual(std::move(data)));
+}
+
+// Function purpose: To add every item of a range
+// Parameters: Input iterators to the first and past the last item
+// Preconditions: Initialized SkipMultiset
+// Postconditions: Every item of the range is in the SkipMultiset; items already in order are appended
+// without a search
+// Return value: void
+// Functions called: insertEqual
+template<class T, class Compare, class Allocator>
+template<class InputIt>
+void SkipMultiset<T, Compare, Allocator>::insert(InputIt first, InputIt last) {
+   for (; first != last; ++first) {
+      insertEqual(*first);
+   }
+}
+
+// Function purpose: To construct an item in place inside a new node and add it to the SkipMultiset
+// Parameters: The arguments of the constructor of T
+// Preconditions: Initialized SkipMultiset
+// Postconditions: The item is in the SkipMultiset, after the items equal to it
+// Return value: iterator to the new item
+// Functions called: SkipList::createNode, SkipList::randomHeight, SkipList::findUpperPredecessors,
+// SkipList::linkNode, linkLast
+template<class T, class Compare, class Allocator>
+template<class... Args>
+typename SkipMultiset<T, Compare, Allocator>::iterator SkipMultiset<T, Compare, Allocator>::emplace(Args&&... args) {
+   // The item has to exist before it can be compared, so the node is built first and placed by its own item
+   SkipListNode *newValue = list_.createNode(list_.randomHeight(), std::forward<Args>(args)...);
+   SkipListNode *last = list_.tails_[0];
+   if (last == nullptr || !list_.comp_(newValue->data_, last->data_)) {
+      linkLast(newValue);
+   }
+   else {
+      typename ListType::SearchPath beforeNodes(list_.maxLevel_);
+      list_.findUpperPredecessors(newValue->data_, beforeNodes);
+      list_.linkNode(newValue, beforeNodes);
+   }
+   return iterator(&list_, newValue);
+}
+
+// Function purpose: To remove every item equal to a given item
+// Parameters: An item
+// Preconditions: Initialized SkipMultiset
+// Postconditions: No item equal to data is in the SkipMultiset
+// Return value: int for the number of items removed
+// Functions called: SkipList::findPredecessors, SkipList::findUpperPredecessors, SkipList::eraseBetween
+template<class T, class Compare, class Allocator>
+int SkipMultiset<T, Compare, Allocator>::erase(const T& data) {
+   typename ListType::SearchPath before(list_.maxLevel_);
+   SkipListNode *found = list_.findPredecessors(data, before);
+   if (found == nullptr || list_.comp_(data, found->data_)) { return 0; }
+   // The equal items lie between the two searches on every level, so one splice removes them all
+   typename ListType::SearchPath after(list_.maxLevel_);
+   list_.findUpperPredecessors(data, after);
+   return list_.eraseBetween(before, after);
+}
+
+// Function purpose: To count the items equal to a given item
+// Parameters: An item
+// Preconditions: Initialized SkipMultiset
+// Postconditions: N/A
+// Return value: int
+// Functions called: SkipList::lowerBoundNode
+template<class T, class Compare, class Allocator>
+int SkipMultiset<T, Compare, Allocator>::count(const T& data) const {
+   int total = 0;
+   for (SkipListNode *curr = list_.lowerBoundNode(data); curr != nullptr && !list_.comp_(data, curr->data_);
+         curr = curr->next(0)) {
+      total++;
+   }
+   return total;
+}
+
+// Function purpose: To check if the SkipMultiset contains an item equal to a given item
+// Parameters: An item
+// Preconditions: Initialized SkipMultiset
+// Postconditions: N/A
+// Return value: bool
+// Functions called: SkipList::contains
+template<class T, class Compare, class Allocator>
+bool SkipMultiset<T, Compare, Allocator>::contains(const T& data) const {
+   return list_.contains(data);
+}
+
+// Function purpose: To locate the first item equal to a given item
+// Parameters: An item
+// Preconditions: Initialized SkipMultiset
+// Postconditions: N/A
+// Return value: iterator to the earliest inserted equal item, or end() if there is none
+// Functions called: SkipList::find
+template<class T, class Compare, class Allocator>
+typename SkipMultiset<T, Compare, Allocator>::iterator SkipMultiset<T, Compare, Allocator>::find(const T& data) const {
+   return list_.find(data);
+}
+
+// Function purpose: To locate the first item that is not less than a given item
+// Parameters: An item
+// Preconditions: Initialized SkipMultiset
+// Postconditions: N/A
+// Return value: iterator, or end() if every item is less than data
+// Functions called: SkipList::lower_bound
+template<class T, class Compare, class Allocator>
+typename SkipMultiset<T, Compare, Allocator>::iterator SkipMultiset<T, Compare, Allocator>::lower_bound(const T& data) const {
+   return list_.lower_bound(data);
+}
+
+// Function purpose: To locate the first item that is greater than a given item
+// Parameters: An item
+// Preconditions: Initialized SkipMultiset
+// Postconditions: N/A
+// Return value: iterator, or end() if no item is greater than data
+// Functions called: SkipList::upper_bound
+template<class T, class Compare, class Allocator>
+typename SkipMultiset<T, Compare, Allocator>::iterator SkipMultiset<T, Compare, Allocator>::upper_bound(const T& data) const {
+   return list_.upper_bound(data);
+}
+
+// Function purpose: To locate the items equal to a given item
+// Parameters: An item
+// Preconditions: Initialized SkipMultiset
+// Postconditions: N/A
+// Return value: pair of lower_bound(data) and upper_bound(data)
+// Functions called: SkipList::lowerBoundNode
+template<class T, class Compare, class Allocator>
+pair<typename SkipMultiset<T, Compare, Allocator>::iterator, typename SkipMultiset<T, Compare, Allocator>::iterator>
+SkipMultiset<T, Compare, Allocator>::equal_range(const T& data) const {
+   // The equal items follow the lower bound, so the upper bound is reached by walking them
+   SkipListNode *first = list_.lowerBoundNode(data);
+   SkipListNode *stop = first;
+   while (stop != nullptr && !list_.comp_(data, stop->data_)) {
+      stop = stop->next(0);
+   }
+   return make_pair(iterator(&list_, first), iterator(&list_, stop));
+}
+
+// Function purpose: To return the number of items in the SkipMultiset
+// Parameters: N/A
+// Preconditions: Initialized SkipMultiset
+// Postconditions: N/A
+// Return value: int
+// Functions called: SkipList::size
+template<class T, class Compare, class Allocator>
+int SkipMultiset<T, Compare, Allocator>::size() const {
+   return list_.size();
+}
+
+// Function purpose: To indicate whether the SkipMultiset is empty
+// Parameters: N/A
+// Preconditions: Initialized SkipMultiset
+// Postconditions: N/A
+// Return value: bool
+// Functions called: SkipList::empty
+template<class T, class Compare, class Allocator>
+bool SkipMultiset<T, Compare, Allocator>::empty() const {
+   return list_.empty();
+}
+
+// Function purpose: To remove every item of the SkipMultiset
+// Parameters: N/A
+// Preconditions: Initialized SkipMultiset
+// Postconditions: Empty SkipMultiset
+// Return value: void
+// Functions called: SkipList::clear
+template<class T, class Compare, class Allocator>
+void SkipMultiset<T, Compare, Allocator>::clear() {
+   list_.clear();
+}
+
+// Function purpose: To return iterators to the first item and past the last item
+// Parameters: N/A
+// Preconditions: Initialized SkipMultiset
+// Postconditions: N/A
+// Return value: iterator
+// Functions called: SkipList::begin, SkipList::end
+template<class T, class Compare, class Allocator>
+typename SkipMultiset<T, Compare, Allocator>::iterator SkipMultiset<T, Compare, Allocator>::begin() const {
+   return list_.begin();
+}
+
+template<class T, class Compare, class Allocator>
+typename SkipMultiset<T, Compare, Allocator>::iterator SkipMultiset<T, Compare, Allocator>::end() const {
+   return list_.end();
+}
+
+// Function purpose: To return reverse iterators to the last item and before the first item
+// Parameters: N/A
+// Preconditions: Initialized SkipMultiset
+// Postconditions: N/A
+// Return value: reverse_iterator
+// Functions called: SkipList::rbegin, SkipList::rend
+template<class T, class Compare, class Allocator>
+typename SkipMultiset<T, Compare, Allocator>::reverse_iterator SkipMultiset<T, Compare, Allocator>::rbegin() const {
+   return list_.rbegin();
+}
+
+template<class T, class Compare, class Allocator>
+typename SkipMultiset<T, Compare, Allocator>::reverse_iterator SkipMultiset<T, Compare, Allocator>::rend() const {
+   return list_.rend();
+}
+
+// Function purpose: To return a copy of the comparator
+// Parameters: N/A
+// Preconditions: Initialized SkipMultiset
+// Postconditions: N/A
+// Return value: key_compare
+// Functions called: SkipList::key_comp
+template<class T, class Compare, class Allocator>
+typename SkipMultiset<T, Compare, Allocator>::key_compare SkipMultiset<T, Compare, Allocator>::key_comp() const {
+   return list_.key_comp();
+}
+
+// Function purpose: To return a copy of the allocator used for items
+// Parameters: N/A
+// Preconditions: Initialized SkipMultiset
+// Postconditions: N/A
+// Return value: allocator_type
+// Functions called: SkipList::get_allocator
+template<class T, class Compare, class Allocator>
+typename SkipMultiset<T, Compare, Allocator>::allocator_type SkipMultiset<T, Compare, Allocator>::get_allocator() const {
+   return list_.get_allocator();
+}
+
+// Function purpose: To check the structure of the SkipMultiset
+// Parameters: N/A
+// Preconditions: Initialized SkipMultiset
+// Postconditions: N/A
+// Return value: bool that is true if the items are in non-decreasing order and every level of the
+// underlying SkipList is linked correctly
+// Functions called: SkipList::checkStructure
+template<class T, class Compare, class Allocator>
+bool SkipMultiset<T, Compare, Allocator>::validate() const {
+   return list_.checkStructure(true);
+}
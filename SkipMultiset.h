@@ -0,0 +1,242 @@
+/*
+SkipMultiset.h
+
+Input & output: SkipMultiset<T> is an ordered collection that, unlike SkipList, keeps every item inserted,
+including items equal to ones already present. insert always adds the item and returns an iterator to it,
+count(value) returns the number of equal items, and erase(value) removes all of them and returns how many
+it removed.
+Program use:
+Include SkipMultiset.h. SkipMultiset<int> objectName; objectName.insert(3); objectName.insert(3);
+objectName.count(3) is then 2. equal_range(value) returns the iterators that bound the equal items, and
+find, lower_bound and upper_bound locate items as they do for SkipList. Iteration visits the items in
+increasing order, and equal items in the order they were inserted.
+Like SkipList, SkipMultiset takes an optional Compare (less<T> by default) and an Allocator (allocator<T>
+by default), e.g. SkipMultiset<int, greater<int>, PoolAllocator<int>> objectName;
+Assumptions:
+Compare is a strict weak ordering on T.
+Description:
+A SkipMultiset owns a SkipList and links its nodes directly, so equal items are stored once each, side by
+side, with no sequence number added to the item or to the comparison. A new item is linked after the last
+node on each level that is not greater than it, which places it behind the items equal to it; an item that
+is not less than the last item is appended without a search. erase(value) finds the predecessors of the
+first equal item and of the first greater item and links the one to the node after the other on every
+level, so all the equal items are cut out in a single splice.
+*/
+
+#pragma once
+
+#include "SkipList.h"
+
+using namespace std;
+
+template<class T, class Compare = less<T>, class Allocator = allocator<T>>
+class SkipMultiset {
+
+public:
+
+   using ListType = SkipList<T, Compare, Allocator>;
+   using value_type = T;
+   using key_compare = Compare;
+   using allocator_type = Allocator;
+   using iterator = typename ListType::iterator;
+   using const_iterator = iterator;
+   using reverse_iterator = typename ListType::reverse_iterator;
+   using const_reverse_iterator = reverse_iterator;
+
+private:
+
+   using SkipListNode = typename ListType::SkipListNode;
+
+   ListType list_;
+
+   // Function purpose: To add an item after every item equal to it
+   // Parameters: An item, forwarded so that an rvalue is moved into the new node
+   // Preconditions: Initialized SkipMultiset
+   // Postconditions: The item is in the SkipMultiset, after the items equal to it
+   // Return value: The new SkipListNode pointer
+   // Functions called: SkipList::findUpperPredecessors, SkipList::createNode, SkipList::linkNode,
+   // linkLast
+   template<class U>
+   SkipListNode* insertEqual(U&& data);
+
+   // Function purpose: To link a new node after the last node of the SkipMultiset
+   // Parameters: The new SkipListNode pointer
+   // Preconditions: The SkipMultiset is empty or its last item is not greater than the item of newValue
+   // Postconditions: The item of newValue is the last item of the SkipMultiset
+   // Return value: void
+   // Functions called: SkipList::appendLinked, SkipList::growIfNeeded
+   void linkLast(SkipListNode *newValue);
+
+public:
+
+   // Function purpose: To initialize an empty SkipMultiset
+   // Parameters: The comparator and the allocator used for items
+   // Preconditions: N/A
+   // Postconditions: An initialized SkipMultiset
+   // Return value: N/A
+   // Functions called: N/A
+   explicit SkipMultiset(const Compare& comp = Compare(), const Allocator& alloc = Allocator());
+
+   // Function purpose: To initialize a SkipMultiset using initializer_list
+   // Parameters: An initialization list of items, the comparator and the allocator used for items
+   // Preconditions: N/A
+   // Postconditions: A SkipMultiset holding every item of the list
+   // Return value: N/A
+   // Functions called: insert
+   SkipMultiset(initializer_list<T> vals, const Compare& comp = Compare(), const Allocator& alloc = Allocator());
+
+   // Function purpose: To add an item, whether or not equal items are present
+   // Parameters: An item to copy or move into a new node
+   // Preconditions: Initialized SkipMultiset
+   // Postconditions: The item is in the SkipMultiset, after the items equal to it
+   // Return value: iterator to the new item
+   // Functions called: insertEqual
+   iterator insert(const T& data);
+   iterator insert(T&& data);
+
+   // Function purpose: To add every item of a range
+   // Parameters: Input iterators to the first and past the last item
+   // Preconditions: Initialized SkipMultiset
+   // Postconditions: Every item of the range is in the SkipMultiset; items already in order are appended
+   // without a search
+   // Return value: void
+   // Functions called: insertEqual
+   template<class InputIt>
+   void insert(InputIt first, InputIt last);
+
+   // Function purpose: To construct an item in place inside a new node and add it to the SkipMultiset
+   // Parameters: The arguments of the constructor of T
+   // Preconditions: Initialized SkipMultiset
+   // Postconditions: The item is in the SkipMultiset, after the items equal to it
+   // Return value: iterator to the new item
+   // Functions called: SkipList::createNode, SkipList::randomHeight, SkipList::findUpperPredecessors,
+   // SkipList::linkNode, linkLast
+   template<class... Args>
+   iterator emplace(Args&&... args);
+
+   // Function purpose: To remove every item equal to a given item
+   // Parameters: An item
+   // Preconditions: Initialized SkipMultiset
+   // Postconditions: No item equal to data is in the SkipMultiset
+   // Return value: int for the number of items removed
+   // Functions called: SkipList::findPredecessors, SkipList::findUpperPredecessors, SkipList::eraseBetween
+   int erase(const T& data);
+
+   // Function purpose: To count the items equal to a given item
+   // Parameters: An item
+   // Preconditions: Initialized SkipMultiset
+   // Postconditions: N/A
+   // Return value: int
+   // Functions called: SkipList::lowerBoundNode
+   int count(const T& data) const;
+
+   // Function purpose: To check if the SkipMultiset contains an item equal to a given item
+   // Parameters: An item
+   // Preconditions: Initialized SkipMultiset
+   // Postconditions: N/A
+   // Return value: bool
+   // Functions called: SkipList::contains
+   bool contains(const T& data) const;
+
+   // Function purpose: To locate the first item equal to a given item
+   // Parameters: An item
+   // Preconditions: Initialized SkipMultiset
+   // Postconditions: N/A
+   // Return value: iterator to the earliest inserted equal item, or end() if there is none
+   // Functions called: SkipList::find
+   iterator find(const T& data) const;
+
+   // Function purpose: To locate the first item that is not less than a given item
+   // Parameters: An item
+   // Preconditions: Initialized SkipMultiset
+   // Postconditions: N/A
+   // Return value: iterator, or end() if every item is less than data
+   // Functions called: SkipList::lower_bound
+   iterator lower_bound(const T& data) const;
+
+   // Function purpose: To locate the first item that is greater than a given item
+   // Parameters: An item
+   // Preconditions: Initialized SkipMultiset
+   // Postconditions: N/A
+   // Return value: iterator, or end() if no item is greater than data
+   // Functions called: SkipList::upper_bound
+   iterator upper_bound(const T& data) const;
+
+   // Function purpose: To locate the items equal to a given item
+   // Parameters: An item
+   // Preconditions: Initialized SkipMultiset
+   // Postconditions: N/A
+   // Return value: pair of lower_bound(data) and upper_bound(data)
+   // Functions called: SkipList::lowerBoundNode
+   pair<iterator, iterator> equal_range(const T& data) const;
+
+   // Function purpose: To return the number of items in the SkipMultiset
+   // Parameters: N/A
+   // Preconditions: Initialized SkipMultiset
+   // Postconditions: N/A
+   // Return value: int
+   // Functions called: SkipList::size
+   int size() const;
+
+   // Function purpose: To indicate whether the SkipMultiset is empty
+   // Parameters: N/A
+   // Preconditions: Initialized SkipMultiset
+   // Postconditions: N/A
+   // Return value: bool
+   // Functions called: SkipList::empty
+   bool empty() const;
+
+   // Function purpose: To remove every item of the SkipMultiset
+   // Parameters: N/A
+   // Preconditions: Initialized SkipMultiset
+   // Postconditions: Empty SkipMultiset
+   // Return value: void
+   // Functions called: SkipList::clear
+   void clear();
+
+   // Function purpose: To return iterators to the first item and past the last item
+   // Parameters: N/A
+   // Preconditions: Initialized SkipMultiset
+   // Postconditions: N/A
+   // Return value: iterator
+   // Functions called: SkipList::begin, SkipList::end
+   iterator begin() const;
+   iterator end() const;
+
+   // Function purpose: To return reverse iterators to the last item and before the first item
+   // Parameters: N/A
+   // Preconditions: Initialized SkipMultiset
+   // Postconditions: N/A
+   // Return value: reverse_iterator
+   // Functions called: SkipList::rbegin, SkipList::rend
+   reverse_iterator rbegin() const;
+   reverse_iterator rend() const;
+
+   // Function purpose: To return a copy of the comparator
+   // Parameters: N/A
+   // Preconditions: Initialized SkipMultiset
+   // Postconditions: N/A
+   // Return value: key_compare
+   // Functions called: SkipList::key_comp
+   key_compare key_comp() const;
+
+   // Function purpose: To return a copy of the allocator used for items
+   // Parameters: N/A
+   // Preconditions: Initialized SkipMultiset
+   // Postconditions: N/A
+   // Return value: allocator_type
+   // Functions called: SkipList::get_allocator
+   allocator_type get_allocator() const;
+
+   // Function purpose: To check the structure of the SkipMultiset
+   // Parameters: N/A
+   // Preconditions: Initialized SkipMultiset
+   // Postconditions: N/A
+   // Return value: bool that is true if the items are in non-decreasing order and every level of the
+   // underlying SkipList is linked correctly
+   // Functions called: SkipList::checkStructure
+   bool validate() const;
+
+};
+
+#include "SkipMultiset.cpp"
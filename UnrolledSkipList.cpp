@@ -0,0 +1,933 @@
+/*
+UnrolledSkipList.cpp
+*/
+
+// Function purpose: To initialize an empty Chunk
+// Parameters: The number of levels the Chunk occupies
+// Preconditions: height is > 0 and storage for height forward pointers follows the Chunk
+// Postconditions: A Chunk with no items and all forward pointers set to nullptr
+// Return value: N/A
+// Functions called: N/A
+template<class T, class Compare, class Allocator, int Capacity>
+UnrolledSkipList<T, Compare, Allocator, Capacity>::Chunk::Chunk(int height) {
+   this->height_ = height;
+   this->count_ = 0;
+   this->prev_ = nullptr;
+   for (int i = 0; i < height; i++) {
+      next(i) = nullptr;
+   }
+}
+
+// Function purpose: To access the forward pointer of the Chunk at a given level
+// Parameters: An int for the level
+// Preconditions: 0 <= level < height_
+// Postconditions: N/A
+// Return value: reference to the forward pointer
+// Functions called: N/A
+template<class T, class Compare, class Allocator, int Capacity>
+typename UnrolledSkipList<T, Compare, Allocator, Capacity>::Chunk*& UnrolledSkipList<T, Compare, Allocator, Capacity>::Chunk::next(int level) {
+   return reinterpret_cast<Chunk**>(this + 1)[level];
+}
+
+template<class T, class Compare, class Allocator, int Capacity>
+typename UnrolledSkipList<T, Compare, Allocator, Capacity>::Chunk* UnrolledSkipList<T, Compare, Allocator, Capacity>::Chunk::next(int level) const {
+   return reinterpret_cast<Chunk* const*>(this + 1)[level];
+}
+
+// Function purpose: To access the items of the Chunk
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: pointer to the first of count_ items
+// Functions called: N/A
+template<class T, class Compare, class Allocator, int Capacity>
+T* UnrolledSkipList<T, Compare, Allocator, Capacity>::Chunk::items() {
+   return std::launder(reinterpret_cast<T*>(storage_));
+}
+
+template<class T, class Compare, class Allocator, int Capacity>
+const T* UnrolledSkipList<T, Compare, Allocator, Capacity>::Chunk::items() const {
+   return std::launder(reinterpret_cast<const T*>(storage_));
+}
+
+// Function purpose: To initialize an empty UnrolledSkipList
+// Parameters: The comparator and the allocator
+// Preconditions: N/A
+// Postconditions: An initialized UnrolledSkipList
+// Return value: N/A
+// Functions called: N/A
+template<class T, class Compare, class Allocator, int Capacity>
+UnrolledSkipList<T, Compare, Allocator, Capacity>::UnrolledSkipList(const Compare& comp, const Allocator& alloc)
+   : chunkAlloc_(alloc), comp_(comp) {
+   maxLevel_ = 1;
+   size_ = 0;
+   chunks_ = 0;
+   for (int i = 0; i < MAX_LEVEL; i++) {
+      heads_[i] = nullptr;
+      tails_[i] = nullptr;
+   }
+}
+
+// Function purpose: To initialize an UnrolledSkipList using initializer_list
+// Parameters: An initialization list, the comparator and the allocator
+// Preconditions: N/A
+// Postconditions: An UnrolledSkipList holding each distinct item of the list
+// Return value: N/A
+// Functions called: insert
+template<class T, class Compare, class Allocator, int Capacity>
+UnrolledSkipList<T, Compare, Allocator, Capacity>::UnrolledSkipList(initializer_list<T> vals, const Compare& comp,
+      const Allocator& alloc)
+   : UnrolledSkipList(comp, alloc) {
+   for (const T& val : vals) {
+      insert(val);
+   }
+}
+
+// Function purpose: To copy-construct an UnrolledSkipList
+// Parameters: An UnrolledSkipList
+// Preconditions: N/A
+// Postconditions: A copy of the parameter
+// Return value: N/A
+// Functions called: copyContents, clear
+template<class T, class Compare, class Allocator, int Capacity>
+UnrolledSkipList<T, Compare, Allocator, Capacity>::UnrolledSkipList(const UnrolledSkipList& toCopy)
+   : chunkAlloc_(ChunkTraits::select_on_container_copy_construction(toCopy.chunkAlloc_)),
+     comp_(toCopy.comp_), levelGenerator_(toCopy.levelGenerator_) {
+   maxLevel_ = 1;
+   size_ = 0;
+   chunks_ = 0;
+   for (int i = 0; i < MAX_LEVEL; i++) {
+      heads_[i] = nullptr;
+      tails_[i] = nullptr;
+   }
+   try {
+      copyContents(toCopy);
+   }
+   catch (...) {
+      clear();
+      throw;
+   }
+}
+
+// Function purpose: To move-construct an UnrolledSkipList
+// Parameters: An UnrolledSkipList
+// Preconditions: N/A
+// Postconditions: This object holds the Chunks of the parameter, which is left empty
+// Return value: N/A
+// Functions called: N/A
+template<class T, class Compare, class Allocator, int Capacity>
+UnrolledSkipList<T, Compare, Allocator, Capacity>::UnrolledSkipList(UnrolledSkipList&& toMove) noexcept
+   : chunkAlloc_(toMove.chunkAlloc_), comp_(toMove.comp_), levelGenerator_(toMove.levelGenerator_) {
+   maxLevel_ = toMove.maxLevel_;
+   size_ = toMove.size_;
+   chunks_ = toMove.chunks_;
+   for (int i = 0; i < MAX_LEVEL; i++) {
+      heads_[i] = toMove.heads_[i];
+      tails_[i] = toMove.tails_[i];
+      toMove.heads_[i] = nullptr;
+      toMove.tails_[i] = nullptr;
+   }
+   toMove.size_ = 0;
+   toMove.chunks_ = 0;
+}
+
+// Function purpose: To copy-assign an UnrolledSkipList
+// Parameters: An UnrolledSkipList as right hand argument
+// Preconditions: N/A
+// Postconditions: A copy of the parameter
+// Return value: reference to this UnrolledSkipList
+// Functions called: clear, copyContents
+template<class T, class Compare, class Allocator, int Capacity>
+UnrolledSkipList<T, Compare, Allocator, Capacity>& UnrolledSkipList<T, Compare, Allocator, Capacity>::operator=(const UnrolledSkipList& rhs) {
+   if (this != &rhs) {
+      clear();
+      if (ChunkTraits::propagate_on_container_copy_assignment::value) {
+         chunkAlloc_ = rhs.chunkAlloc_;
+      }
+      comp_ = rhs.comp_;
+      levelGenerator_ = rhs.levelGenerator_;
+      copyContents(rhs);
+   }
+   return *this;
+}
+
+// Function purpose: To move-assign an UnrolledSkipList
+// Parameters: An UnrolledSkipList as right hand argument
+// Preconditions: N/A
+// Postconditions: This object holds the items of the parameter, which is left empty
+// Return value: reference to this UnrolledSkipList
+// Functions called: clear, copyContents
+template<class T, class Compare, class Allocator, int Capacity>
+UnrolledSkipList<T, Compare, Allocator, Capacity>& UnrolledSkipList<T, Compare, Allocator, Capacity>::operator=(UnrolledSkipList&& rhs) {
+   if (this != &rhs) {
+      clear();
+      comp_ = rhs.comp_;
+      levelGenerator_ = rhs.levelGenerator_;
+      if (!ChunkTraits::propagate_on_container_move_assignment::value && chunkAlloc_ != rhs.chunkAlloc_) {
+         // The Chunks of rhs cannot be released through this allocator, so they are copied instead
+         copyContents(rhs);
+         return *this;
+      }
+      if (ChunkTraits::propagate_on_container_move_assignment::value) {
+         chunkAlloc_ = rhs.chunkAlloc_;
+      }
+      maxLevel_ = rhs.maxLevel_;
+      size_ = rhs.size_;
+      chunks_ = rhs.chunks_;
+      for (int i = 0; i < MAX_LEVEL; i++) {
+         heads_[i] = rhs.heads_[i];
+         tails_[i] = rhs.tails_[i];
+         rhs.heads_[i] = nullptr;
+         rhs.tails_[i] = nullptr;
+      }
+      rhs.size_ = 0;
+      rhs.chunks_ = 0;
+   }
+   return *this;
+}
+
+// Function purpose: To destroy an UnrolledSkipList
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: Every Chunk has been released
+// Return value: N/A
+// Functions called: clear
+template<class T, class Compare, class Allocator, int Capacity>
+UnrolledSkipList<T, Compare, Allocator, Capacity>::~UnrolledSkipList() {
+   clear();
+}
+
+// Function purpose: To allocate an empty Chunk and its forward pointers in a single block
+// Parameters: The number of levels the Chunk occupies
+// Preconditions: 0 < height <= maxLevel_
+// Postconditions: A Chunk that is not linked into any level
+// Return value: Chunk pointer
+// Functions called: chunkSlots
+template<class T, class Compare, class Allocator, int Capacity>
+typename UnrolledSkipList<T, Compare, Allocator, Capacity>::Chunk* UnrolledSkipList<T, Compare, Allocator, Capacity>::createChunk(int height) {
+   ChunkSlot *block = ChunkTraits::allocate(chunkAlloc_, chunkSlots(height));
+   return new (static_cast<void*>(block)) Chunk(height);
+}
+
+// Function purpose: To destroy the items of a Chunk and release its block
+// Parameters: A Chunk pointer
+// Preconditions: Chunk was returned by createChunk and is no longer linked
+// Postconditions: The Chunk no longer exists in memory
+// Return value: void
+// Functions called: chunkSlots
+template<class T, class Compare, class Allocator, int Capacity>
+void UnrolledSkipList<T, Compare, Allocator, Capacity>::destroyChunk(Chunk *chunk) {
+   int height = chunk->height_;
+   T *items = chunk->items();
+   for (int i = 0; i < chunk->count_; i++) {
+      items[i].~T();
+   }
+   chunk->~Chunk();
+   ChunkTraits::deallocate(chunkAlloc_, reinterpret_cast<ChunkSlot*>(chunk), chunkSlots(height));
+}
+
+// Function purpose: To compute how many ChunkSlots a Chunk of a given height occupies
+// Parameters: An int for the height
+// Preconditions: height is > 0
+// Postconditions: N/A
+// Return value: size_t
+// Functions called: N/A
+template<class T, class Compare, class Allocator, int Capacity>
+size_t UnrolledSkipList<T, Compare, Allocator, Capacity>::chunkSlots(int height) {
+   size_t bytes = sizeof(Chunk) + height * sizeof(Chunk*);
+   return (bytes + sizeof(ChunkSlot) - 1) / sizeof(ChunkSlot);
+}
+
+// Function purpose: To return the Chunk following a predecessor at a given level
+// Parameters: A Chunk pointer (nullptr stands for the head of the level) and an int for the level
+// Preconditions: pred occupies the level if it is not nullptr
+// Postconditions: N/A
+// Return value: Chunk pointer
+// Functions called: N/A
+template<class T, class Compare, class Allocator, int Capacity>
+typename UnrolledSkipList<T, Compare, Allocator, Capacity>::Chunk* UnrolledSkipList<T, Compare, Allocator, Capacity>::successor(Chunk *pred, int level) const {
+   return (pred == nullptr) ? heads_[level] : pred->next(level);
+}
+
+// Function purpose: To find the last Chunk on every level whose first item is less than an item
+// Parameters: An item and an array of MAX_LEVEL entries to receive the predecessors, or nullptr
+// Preconditions: N/A
+// Postconditions: preds[i], if given, is the last such Chunk on level i (nullptr for the head)
+// Return value: The last such Chunk on the lowest level, or nullptr
+// Functions called: successor
+template<class T, class Compare, class Allocator, int Capacity>
+typename UnrolledSkipList<T, Compare, Allocator, Capacity>::Chunk* UnrolledSkipList<T, Compare, Allocator, Capacity>::findChunkBefore(const T& data,
+      Chunk **preds) const {
+   Chunk *pred = nullptr;
+   for (int level = maxLevel_ - 1; level >= 0; level--) {
+      Chunk *succ = successor(pred, level);
+      while (succ != nullptr && comp_(succ->items()[0], data)) {
+         pred = succ;
+         succ = succ->next(level);
+      }
+      if (preds != nullptr) { preds[level] = pred; }
+   }
+   return pred;
+}
+
+// Function purpose: To find the position of the first item of a Chunk that is not less than an item
+// Parameters: A Chunk and an item
+// Preconditions: chunk is not nullptr and holds at least one item
+// Postconditions: N/A
+// Return value: int between 0 and chunk->count_
+// Functions called: SimdSearch::lowerBound
+template<class T, class Compare, class Allocator, int Capacity>
+int UnrolledSkipList<T, Compare, Allocator, Capacity>::lowerBoundIn(const Chunk *chunk, const T& data) const {
+   if constexpr (SimdSearch::supports<T, Compare>()) {
+      return SimdSearch::lowerBound(chunk->items(), chunk->count_, data);
+   }
+   // Halving the range on every step regardless of the comparison leaves the compiler a conditional
+   // move instead of a branch that mispredicts half of the time
+   const T *items = chunk->items();
+   const T *base = items;
+   int n = chunk->count_;
+   while (n > 1) {
+      int half = n / 2;
+      base = comp_(base[half], data) ? base + half : base;
+      n -= half;
+   }
+   return static_cast<int>(base - items) + (comp_(*base, data) ? 1 : 0);
+}
+
+// Function purpose: To find the Chunk and position holding an item, if any
+// Parameters: An item, and an array of MAX_LEVEL entries to receive the predecessors of the Chunk
+// found, or nullptr
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: pair of the Chunk and position of the first item not less than data; the Chunk is
+// nullptr if every item is less than data
+// Functions called: findChunkBefore, lowerBoundIn
+template<class T, class Compare, class Allocator, int Capacity>
+pair<typename UnrolledSkipList<T, Compare, Allocator, Capacity>::Chunk*, int> UnrolledSkipList<T, Compare, Allocator, Capacity>::locate(const T& data,
+      Chunk **preds) const {
+   Chunk *chunk = findChunkBefore(data, preds);
+   if (chunk == nullptr) {
+      return make_pair(heads_[0], 0);
+   }
+   int pos = lowerBoundIn(chunk, data);
+   if (pos == chunk->count_) {
+      // The first item of the next Chunk is not less than data
+      return make_pair(chunk->next(0), 0);
+   }
+   return make_pair(chunk, pos);
+}
+
+// Function purpose: To link a Chunk after its predecessors on every level it occupies
+// Parameters: The Chunk and predecessors no later than it on every level
+// Preconditions: The Chunk holds at least one item and is not linked
+// Postconditions: The Chunk is linked on levels 0 to height_ - 1
+// Return value: void
+// Functions called: successor
+template<class T, class Compare, class Allocator, int Capacity>
+void UnrolledSkipList<T, Compare, Allocator, Capacity>::linkChunk(Chunk *chunk, Chunk **preds) {
+   const T& first = chunk->items()[0];
+   for (int level = 0; level < chunk->height_; level++) {
+      Chunk *pred = preds[level];
+      Chunk *succ = successor(pred, level);
+      while (succ != nullptr && comp_(succ->items()[0], first)) {
+         pred = succ;
+         succ = succ->next(level);
+      }
+      chunk->next(level) = succ;
+      if (pred == nullptr) {
+         heads_[level] = chunk;
+      }
+      else {
+         pred->next(level) = chunk;
+      }
+      if (succ == nullptr) {
+         tails_[level] = chunk;
+      }
+      if (level == 0) {
+         chunk->prev_ = pred;
+         if (succ != nullptr) { succ->prev_ = chunk; }
+      }
+   }
+   chunks_ += 1;
+}
+
+// Function purpose: To unlink a Chunk from every level and destroy it
+// Parameters: The Chunk and its predecessors on every level it occupies
+// Preconditions: preds[i] is directly before chunk on level i for every level it occupies
+// Postconditions: The Chunk no longer exists
+// Return value: void
+// Functions called: successor, destroyChunk
+template<class T, class Compare, class Allocator, int Capacity>
+void UnrolledSkipList<T, Compare, Allocator, Capacity>::unlinkChunk(Chunk *chunk, Chunk **preds) {
+   for (int level = 0; level < chunk->height_; level++) {
+      if (preds[level] == nullptr) {
+         heads_[level] = chunk->next(level);
+      }
+      else {
+         preds[level]->next(level) = chunk->next(level);
+      }
+      if (tails_[level] == chunk) {
+         tails_[level] = preds[level];
+      }
+   }
+   if (chunk->next(0) != nullptr) {
+      chunk->next(0)->prev_ = chunk->prev_;
+   }
+   destroyChunk(chunk);
+   chunks_ -= 1;
+}
+
+// Function purpose: To move the upper half of a full Chunk into a new Chunk linked after it
+// Parameters: The full Chunk and predecessors no later than it on every level
+// Preconditions: chunk->count_ == Capacity
+// Postconditions: Both Chunks are half full
+// Return value: The new Chunk
+// Functions called: createChunk, randomHeight, linkChunk, growIfNeeded
+template<class T, class Compare, class Allocator, int Capacity>
+typename UnrolledSkipList<T, Compare, Allocator, Capacity>::Chunk* UnrolledSkipList<T, Compare, Allocator, Capacity>::splitChunk(Chunk *chunk,
+      Chunk **preds) {
+   Chunk *upper = createChunk(randomHeight());
+   T *from = chunk->items();
+   int half = chunk->count_ / 2;
+   try {
+      for (int i = half; i < chunk->count_; i++) {
+         new (static_cast<void*>(upper->items() + upper->count_)) T(std::move(from[i]));
+         upper->count_ += 1;
+      }
+   }
+   catch (...) {
+      destroyChunk(upper);
+      throw;
+   }
+   for (int i = half; i < chunk->count_; i++) {
+      from[i].~T();
+   }
+   chunk->count_ = half;
+   linkChunk(upper, preds);
+   growIfNeeded();
+   return upper;
+}
+
+// Function purpose: To move the items of the next Chunk into a sparse Chunk when both fit
+// Parameters: A Chunk
+// Preconditions: chunk holds at least one item
+// Postconditions: The next Chunk is unlinked if its items were moved
+// Return value: bool that is true if the Chunks were merged
+// Functions called: findChunkBefore, unlinkChunk
+template<class T, class Compare, class Allocator, int Capacity>
+bool UnrolledSkipList<T, Compare, Allocator, Capacity>::mergeWithNext(Chunk *chunk) {
+   Chunk *next = chunk->next(0);
+   if (next == nullptr || chunk->count_ + next->count_ > Capacity * 3 / 4) {
+      return false;
+   }
+   Chunk *preds[MAX_LEVEL];
+   findChunkBefore(next->items()[0], preds);
+   T *from = next->items();
+   T *to = chunk->items();
+   for (int i = 0; i < next->count_; i++) {
+      new (static_cast<void*>(to + chunk->count_)) T(std::move(from[i]));
+      chunk->count_ += 1;
+   }
+   unlinkChunk(next, preds);
+   return true;
+}
+
+// Function purpose: To add an item at a position of a Chunk, shifting the items after it
+// Parameters: The Chunk, the position and the item
+// Preconditions: count_ < Capacity and pos <= count_
+// Postconditions: The items stay contiguous and sorted
+// Return value: void
+// Functions called: N/A
+template<class T, class Compare, class Allocator, int Capacity>
+template<class U>
+void UnrolledSkipList<T, Compare, Allocator, Capacity>::insertAt(Chunk *chunk, int pos, U&& data) {
+   T *items = chunk->items();
+   int count = chunk->count_;
+   if (pos == count) {
+      new (static_cast<void*>(items + count)) T(std::forward<U>(data));
+   }
+   else {
+      new (static_cast<void*>(items + count)) T(std::move(items[count - 1]));
+      for (int i = count - 1; i > pos; i--) {
+         items[i] = std::move(items[i - 1]);
+      }
+      items[pos] = std::forward<U>(data);
+   }
+   chunk->count_ += 1;
+}
+
+// Function purpose: To remove the item at a position of a Chunk, shifting the items after it
+// Parameters: The Chunk and the position
+// Preconditions: pos < count_
+// Postconditions: The items stay contiguous and sorted
+// Return value: void
+// Functions called: N/A
+template<class T, class Compare, class Allocator, int Capacity>
+void UnrolledSkipList<T, Compare, Allocator, Capacity>::eraseAt(Chunk *chunk, int pos) {
+   T *items = chunk->items();
+   for (int i = pos; i < chunk->count_ - 1; i++) {
+      items[i] = std::move(items[i + 1]);
+   }
+   items[chunk->count_ - 1].~T();
+   chunk->count_ -= 1;
+}
+
+// Function purpose: To choose the number of levels a new Chunk occupies
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: int between 1 and maxLevel_
+// Functions called: LevelGenerator::height
+template<class T, class Compare, class Allocator, int Capacity>
+int UnrolledSkipList<T, Compare, Allocator, Capacity>::randomHeight() {
+   return levelGenerator_.height(maxLevel_);
+}
+
+// Function purpose: To add a level when the number of Chunks outgrows the current levels
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: maxLevel_ is large enough for chunks_ Chunks, or equal to MAX_LEVEL
+// Return value: void
+// Functions called: LevelGenerator::capacity
+template<class T, class Compare, class Allocator, int Capacity>
+void UnrolledSkipList<T, Compare, Allocator, Capacity>::growIfNeeded() {
+   // The upper levels index Chunks rather than items, so they grow with the number of Chunks
+   uint64_t chunks = static_cast<uint64_t>(chunks_);
+   while (maxLevel_ < MAX_LEVEL && chunks > levelGenerator_.capacity(maxLevel_)) {
+      maxLevel_ += 1;
+   }
+}
+
+// Function purpose: To copy the Chunks of another UnrolledSkipList, keeping their heights
+// Parameters: An UnrolledSkipList
+// Preconditions: This UnrolledSkipList is empty
+// Postconditions: Both hold the same items in Chunks of the same sizes and heights
+// Return value: void
+// Functions called: createChunk
+template<class T, class Compare, class Allocator, int Capacity>
+void UnrolledSkipList<T, Compare, Allocator, Capacity>::copyContents(const UnrolledSkipList& toCopy) {
+   maxLevel_ = toCopy.maxLevel_;
+   for (Chunk *curr = toCopy.heads_[0]; curr != nullptr; curr = curr->next(0)) {
+      Chunk *copy = createChunk(curr->height_);
+      try {
+         for (int i = 0; i < curr->count_; i++) {
+            new (static_cast<void*>(copy->items() + i)) T(curr->items()[i]);
+            copy->count_ += 1;
+         }
+      }
+      catch (...) {
+         destroyChunk(copy);
+         throw;
+      }
+      // Chunks arrive in order, so each one is appended after the tail of every level it occupies
+      copy->prev_ = tails_[0];
+      for (int level = 0; level < copy->height_; level++) {
+         if (tails_[level] == nullptr) {
+            heads_[level] = copy;
+         }
+         else {
+            tails_[level]->next(level) = copy;
+         }
+         tails_[level] = copy;
+      }
+      size_ += copy->count_;
+      chunks_ += 1;
+   }
+}
+
+// Function purpose: To add an item unless an equal item is present
+// Parameters: An item, forwarded so that an rvalue is moved into its slot
+// Preconditions: N/A
+// Postconditions: The item is in the UnrolledSkipList; data is left untouched if it already was
+// Return value: pair of an iterator to the item and a bool that is true if the item was inserted
+// Functions called: findChunkBefore, lowerBoundIn, splitChunk, insertAt, createChunk, linkChunk
+template<class T, class Compare, class Allocator, int Capacity>
+template<class U>
+pair<typename UnrolledSkipList<T, Compare, Allocator, Capacity>::iterator, bool> UnrolledSkipList<T, Compare, Allocator, Capacity>::insertUnique(U&& data) {
+   Chunk *preds[MAX_LEVEL];
+   Chunk *chunk = findChunkBefore(data, preds);
+   int pos = 0;
+   if (chunk == nullptr) {
+      chunk = heads_[0];
+      if (chunk == nullptr) {
+         chunk = createChunk(randomHeight());
+         try {
+            insertAt(chunk, 0, std::forward<U>(data));
+         }
+         catch (...) {
+            destroyChunk(chunk);
+            throw;
+         }
+         linkChunk(chunk, preds);
+         size_ += 1;
+         return make_pair(iterator(this, chunk, 0), true);
+      }
+      if (!comp_(data, chunk->items()[0])) {
+         return make_pair(iterator(this, chunk, 0), false);
+      }
+      // data becomes the first item of the first Chunk
+   }
+   else {
+      pos = lowerBoundIn(chunk, data);
+      if (pos < chunk->count_ && !comp_(data, chunk->items()[pos])) {
+         return make_pair(iterator(this, chunk, pos), false);
+      }
+      Chunk *next = chunk->next(0);
+      if (pos == chunk->count_ && next != nullptr && !comp_(data, next->items()[0])) {
+         return make_pair(iterator(this, next, 0), false);
+      }
+   }
+
+   if (chunk->count_ == Capacity) {
+      if (pos == Capacity && chunk->next(0) == nullptr) {
+         // Items arriving in increasing order start a new Chunk instead of leaving half-full ones behind
+         Chunk *last = createChunk(randomHeight());
+         try {
+            insertAt(last, 0, std::forward<U>(data));
+         }
+         catch (...) {
+            destroyChunk(last);
+            throw;
+         }
+         linkChunk(last, preds);
+         growIfNeeded();
+         size_ += 1;
+         return make_pair(iterator(this, last, 0), true);
+      }
+      Chunk *upper = splitChunk(chunk, preds);
+      if (pos > chunk->count_) {
+         pos -= chunk->count_;
+         chunk = upper;
+      }
+   }
+   insertAt(chunk, pos, std::forward<U>(data));
+   size_ += 1;
+   return make_pair(iterator(this, chunk, pos), true);
+}
+
+// Function purpose: To add an item unless an equal item is present
+// Parameters: An item to copy into the UnrolledSkipList
+// Preconditions: N/A
+// Postconditions: The item is in the UnrolledSkipList
+// Return value: pair of an iterator to the item and a bool that is true if the item was inserted
+// Functions called: insertUnique
+template<class T, class Compare, class Allocator, int Capacity>
+pair<typename UnrolledSkipList<T, Compare, Allocator, Capacity>::iterator, bool> UnrolledSkipList<T, Compare, Allocator, Capacity>::insert(const T& data) {
+   return insertUnique(data);
+}
+
+// Function purpose: To add an item unless an equal item is present
+// Parameters: An item to move into the UnrolledSkipList
+// Preconditions: N/A
+// Postconditions: The item is in the UnrolledSkipList
+// Return value: pair of an iterator to the item and a bool that is true if the item was inserted
+// Functions called: insertUnique
+template<class T, class Compare, class Allocator, int Capacity>
+pair<typename UnrolledSkipList<T, Compare, Allocator, Capacity>::iterator, bool> UnrolledSkipList<T, Compare, Allocator, Capacity>::insert(T&& data) {
+   return insertUnique(std::move(data));
+}
+
+// Function purpose: To remove an item
+// Parameters: An item
+// Preconditions: N/A
+// Postconditions: The item is no longer in the UnrolledSkipList
+// Return value: int for the number of items removed (0 or 1)
+// Functions called: locate, eraseAt, unlinkChunk, mergeWithNext
+template<class T, class Compare, class Allocator, int Capacity>
+int UnrolledSkipList<T, Compare, Allocator, Capacity>::erase(const T& data) {
+   Chunk *preds[MAX_LEVEL];
+   pair<Chunk*, int> found = locate(data, preds);
+   Chunk *chunk = found.first;
+   if (chunk == nullptr || comp_(data, chunk->items()[found.second])) {
+      return 0;
+   }
+   eraseAt(chunk, found.second);
+   size_ -= 1;
+   if (chunk->count_ == 0) {
+      // Only a Chunk whose first item was data can become empty, and preds lead to exactly that Chunk
+      unlinkChunk(chunk, preds);
+   }
+   else if (chunk->count_ < Capacity / 4 && !mergeWithNext(chunk) && chunk->prev_ != nullptr) {
+      mergeWithNext(chunk->prev_);
+   }
+   return 1;
+}
+
+// Function purpose: To check if the UnrolledSkipList contains an item
+// Parameters: An item
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: bool
+// Functions called: locate
+template<class T, class Compare, class Allocator, int Capacity>
+bool UnrolledSkipList<T, Compare, Allocator, Capacity>::contains(const T& data) const {
+   pair<Chunk*, int> found = locate(data, nullptr);
+   return found.first != nullptr && !comp_(data, found.first->items()[found.second]);
+}
+
+// Function purpose: To locate an item
+// Parameters: An item
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: iterator to the item, or end() if it is not present
+// Functions called: locate
+template<class T, class Compare, class Allocator, int Capacity>
+typename UnrolledSkipList<T, Compare, Allocator, Capacity>::iterator UnrolledSkipList<T, Compare, Allocator, Capacity>::find(const T& data) const {
+   pair<Chunk*, int> found = locate(data, nullptr);
+   if (found.first == nullptr || comp_(data, found.first->items()[found.second])) {
+      return end();
+   }
+   return iterator(this, found.first, found.second);
+}
+
+// Function purpose: To locate the first item that is not less than an item
+// Parameters: An item
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: iterator, or end() if every item is less than data
+// Functions called: locate
+template<class T, class Compare, class Allocator, int Capacity>
+typename UnrolledSkipList<T, Compare, Allocator, Capacity>::iterator UnrolledSkipList<T, Compare, Allocator, Capacity>::lower_bound(const T& data) const {
+   pair<Chunk*, int> found = locate(data, nullptr);
+   return iterator(this, found.first, found.second);
+}
+
+// Function purpose: To check the structure of the UnrolledSkipList
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: bool that is true if no Chunk is empty or over Capacity, every item is greater than the
+// one before it, every level is a subsequence of the level below and prev_, heads_, tails_, size_ and
+// chunks_ agree with the links
+// Functions called: N/A
+template<class T, class Compare, class Allocator, int Capacity>
+bool UnrolledSkipList<T, Compare, Allocator, Capacity>::validate() const {
+   if (maxLevel_ < 1 || maxLevel_ > MAX_LEVEL) { return false; }
+   for (int level = maxLevel_; level < MAX_LEVEL; level++) {
+      if (heads_[level] != nullptr || tails_[level] != nullptr) { return false; }
+   }
+
+   int items = 0;
+   int chunks = 0;
+   const T *last = nullptr;
+   Chunk *prev = nullptr;
+   for (Chunk *curr = heads_[0]; curr != nullptr; curr = curr->next(0)) {
+      if (curr->prev_ != prev || curr->count_ < 1 || curr->count_ > Capacity) { return false; }
+      if (curr->height_ < 1 || curr->height_ > maxLevel_) { return false; }
+      for (int i = 0; i < curr->count_; i++) {
+         if (last != nullptr && !comp_(*last, curr->items()[i])) { return false; }
+         last = curr->items() + i;
+      }
+      items += curr->count_;
+      chunks += 1;
+      prev = curr;
+   }
+   if (tails_[0] != prev || items != size_ || chunks != chunks_) { return false; }
+
+   // Each upper level must be exactly the Chunks of the level below that are tall enough, in order
+   for (int level = 1; level < maxLevel_; level++) {
+      Chunk *below = heads_[level - 1];
+      Chunk *tail = nullptr;
+      for (Chunk *curr = heads_[level]; curr != nullptr; curr = curr->next(level)) {
+         while (below != nullptr && below != curr) {
+            if (below->height_ > level) { return false; }
+            below = below->next(level - 1);
+         }
+         if (below == nullptr) { return false; }
+         below = below->next(level - 1);
+         tail = curr;
+      }
+      for (; below != nullptr; below = below->next(level - 1)) {
+         if (below->height_ > level) { return false; }
+      }
+      if (tails_[level] != tail) { return false; }
+   }
+   return true;
+}
+
+// Function purpose: To return the number of items
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: int
+// Functions called: N/A
+template<class T, class Compare, class Allocator, int Capacity>
+int UnrolledSkipList<T, Compare, Allocator, Capacity>::size() const {
+   return size_;
+}
+
+// Function purpose: To check whether there are no items
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: bool
+// Functions called: N/A
+template<class T, class Compare, class Allocator, int Capacity>
+bool UnrolledSkipList<T, Compare, Allocator, Capacity>::empty() const {
+   return size_ == 0;
+}
+
+// Function purpose: To remove every item
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: Empty UnrolledSkipList; every Chunk has been released in one pass over the lowest level
+// Return value: void
+// Functions called: destroyChunk
+template<class T, class Compare, class Allocator, int Capacity>
+void UnrolledSkipList<T, Compare, Allocator, Capacity>::clear() {
+   Chunk *curr = heads_[0];
+   while (curr != nullptr) {
+      Chunk *next = curr->next(0);
+      destroyChunk(curr);
+      curr = next;
+   }
+   for (int i = 0; i < MAX_LEVEL; i++) {
+      heads_[i] = nullptr;
+      tails_[i] = nullptr;
+   }
+   size_ = 0;
+   chunks_ = 0;
+}
+
+// Function purpose: To return an iterator to the first item
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: iterator
+// Functions called: N/A
+template<class T, class Compare, class Allocator, int Capacity>
+typename UnrolledSkipList<T, Compare, Allocator, Capacity>::iterator UnrolledSkipList<T, Compare, Allocator, Capacity>::begin() const {
+   return iterator(this, heads_[0], 0);
+}
+
+// Function purpose: To return an iterator past the last item
+// Parameters: N/A
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: iterator
+// Functions called: N/A
+template<class T, class Compare, class Allocator, int Capacity>
+typename UnrolledSkipList<T, Compare, Allocator, Capacity>::iterator UnrolledSkipList<T, Compare, Allocator, Capacity>::end() const {
+   return iterator(this, nullptr, 0);
+}
+
+// Function purpose: To construct an iterator for the UnrolledSkipList
+// Parameters: A pointer to an UnrolledSkipList, a Chunk of it and a position in the Chunk
+// Preconditions: pos < chunk->count_, or chunk is nullptr for end()
+// Postconditions: Iterator located at the item
+// Return value: N/A
+// Functions called: N/A
+template<class T, class Compare, class Allocator, int Capacity>
+UnrolledSkipList<T, Compare, Allocator, Capacity>::iterator::iterator(const UnrolledSkipList *listPtr, Chunk *chunkPtr, int pos) {
+   listPtr_ = listPtr;
+   chunkPtr_ = chunkPtr;
+   pos_ = pos;
+}
+
+// Function purpose: To return the item at the iterator
+// Parameters: N/A
+// Preconditions: The iterator is not at end()
+// Postconditions: N/A
+// Return value: const reference to the item
+// Functions called: N/A
+template<class T, class Compare, class Allocator, int Capacity>
+const T& UnrolledSkipList<T, Compare, Allocator, Capacity>::iterator::operator*() const {
+   return chunkPtr_->items()[pos_];
+}
+
+// Function purpose: To access a member of the item at the iterator
+// Parameters: N/A
+// Preconditions: The iterator is not at end()
+// Postconditions: N/A
+// Return value: const pointer to the item
+// Functions called: N/A
+template<class T, class Compare, class Allocator, int Capacity>
+const T* UnrolledSkipList<T, Compare, Allocator, Capacity>::iterator::operator->() const {
+   return chunkPtr_->items() + pos_;
+}
+
+// Function purpose: To move the iterator to the next item
+// Parameters: N/A
+// Preconditions: The iterator is not at end()
+// Postconditions: Moved iterator; moving past the last item of a Chunk goes to the next Chunk
+// Return value: reference to the iterator
+// Functions called: N/A
+template<class T, class Compare, class Allocator, int Capacity>
+typename UnrolledSkipList<T, Compare, Allocator, Capacity>::iterator& UnrolledSkipList<T, Compare, Allocator, Capacity>::iterator::operator++() {
+   pos_ += 1;
+   if (pos_ == chunkPtr_->count_) {
+      chunkPtr_ = chunkPtr_->next(0);
+      pos_ = 0;
+   }
+   return *this;
+}
+
+// Function purpose: To move the iterator to the next item
+// Parameters: int to mark the postfix form
+// Preconditions: The iterator is not at end()
+// Postconditions: Moved iterator
+// Return value: iterator at the item before the move
+// Functions called: operator++()
+template<class T, class Compare, class Allocator, int Capacity>
+typename UnrolledSkipList<T, Compare, Allocator, Capacity>::iterator UnrolledSkipList<T, Compare, Allocator, Capacity>::iterator::operator++(int) {
+   iterator before = *this;
+   ++(*this);
+   return before;
+}
+
+// Function purpose: To move the iterator to the previous item
+// Parameters: N/A
+// Preconditions: The iterator is not at begin()
+// Postconditions: Moved iterator; moving back from end() goes to the last item
+// Return value: reference to the iterator
+// Functions called: N/A
+template<class T, class Compare, class Allocator, int Capacity>
+typename UnrolledSkipList<T, Compare, Allocator, Capacity>::iterator& UnrolledSkipList<T, Compare, Allocator, Capacity>::iterator::operator--() {
+   if (chunkPtr_ == nullptr) {
+      chunkPtr_ = listPtr_->tails_[0];
+      pos_ = chunkPtr_->count_ - 1;
+   }
+   else if (pos_ == 0) {
+      chunkPtr_ = chunkPtr_->prev_;
+      pos_ = chunkPtr_->count_ - 1;
+   }
+   else {
+      pos_ -= 1;
+   }
+   return *this;
+}
+
+// Function purpose: To move the iterator to the previous item
+// Parameters: int to mark the postfix form
+// Preconditions: The iterator is not at begin()
+// Postconditions: Moved iterator
+// Return value: iterator at the item before the move
+// Functions called: operator--()
+template<class T, class Compare, class Allocator, int Capacity>
+typename UnrolledSkipList<T, Compare, Allocator, Capacity>::iterator UnrolledSkipList<T, Compare, Allocator, Capacity>::iterator::operator--(int) {
+   iterator before = *this;
+   --(*this);
+   return before;
+}
+
+// Function purpose: To determine whether two iterators are at the same item
+// Parameters: An iterator
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: bool
+// Functions called: N/A
+template<class T, class Compare, class Allocator, int Capacity>
+bool UnrolledSkipList<T, Compare, Allocator, Capacity>::iterator::operator==(const iterator& rhs) const {
+   return chunkPtr_ == rhs.chunkPtr_ && pos_ == rhs.pos_;
+}
+
+// Function purpose: To determine whether two iterators are at different items
+// Parameters: An iterator
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: bool
+// Functions called: operator==
+template<class T, class Compare, class Allocator, int Capacity>
+bool UnrolledSkipList<T, Compare, Allocator, Capacity>::iterator::operator!=(const iterator& rhs) const {
+   return !(*this == rhs);
+}
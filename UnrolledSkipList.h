@@ -0,0 +1,415 @@
+/*
+UnrolledSkipList.h
+
+Input & output: UnrolledSkipList<T> is an ordered set of unique items with the interface of SkipList
+(insert, erase, contains, find, lower_bound and bidirectional iteration), but each node on the lowest level
+holds a small sorted array of items instead of a single item.
+Program use:
+Include UnrolledSkipList.h. UnrolledSkipList<int> objectName; objectName.insert(5);
+The optional Compare and Allocator arguments work as for SkipList. The last template argument is the
+number of items per node; by default a node holds about 256 bytes (four cache lines) of items, and never
+fewer than 8 or more than 64 items: UnrolledSkipList<int, less<int>, allocator<int>, 32> objectName;
+Assumptions:
+Compare is a strict weak ordering. T is move constructible and move assignable. Iterators, pointers and
+references are invalidated by any insert or erase, because items move between the slots of a node and
+between nodes when nodes split and merge.
+Description:
+The upper levels link nodes exactly as in SkipList, and a node is ordered on them by its first item. A
+search descends to the last node whose first item is less than the key and finishes with a branchless
+binary search inside that node, so the final steps of a search and every scan read contiguous items
+rather than chasing one pointer per item. For integer and floating-point items ordered by less, the search
+inside a node compares a vector of items per instruction instead (see SimdSearch.h).
+An insert into a full node first splits it in half, and the new upper half becomes a node of its own with
+a random height. An erase that leaves a node empty unlinks it. An erase that leaves it less than a quarter
+full merges it with the next node, or failing that with the previous one, when both fit in three quarters
+of a node, which keeps nodes dense without splitting again at once. Items that arrive in increasing order
+fill the last node and then start a new one rather than splitting it. Levels are added as the number of nodes grows, as in SkipList.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+#include <functional>
+#include <initializer_list>
+#include "LevelGenerator.h"
+#include "SimdSearch.h"
+
+using namespace std;
+
+// Function purpose: To choose the default number of items per node of an UnrolledSkipList
+// Parameters: The size of an item in bytes
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: int; 256 bytes worth of items, between 8 and 64
+// Functions called: N/A
+constexpr int unrolledCapacity(size_t itemSize) {
+   return (256 / itemSize < 8) ? 8 : (256 / itemSize > 64) ? 64 : static_cast<int>(256 / itemSize);
+}
+
+template<class T, class Compare = less<T>, class Allocator = allocator<T>, int Capacity = unrolledCapacity(sizeof(T))>
+
+class UnrolledSkipList {
+
+   static_assert(Capacity >= 4, "an UnrolledSkipList node must hold at least 4 items");
+
+private:
+
+   struct Chunk {
+      // Function purpose: To initialize an empty Chunk
+      // Parameters: The number of levels the Chunk occupies
+      // Preconditions: height is > 0 and storage for height forward pointers follows the Chunk
+      // Postconditions: A Chunk with no items and all forward pointers set to nullptr
+      // Return value: N/A
+      // Functions called: N/A
+      explicit Chunk(int height);
+
+      // Function purpose: To access the forward pointer of the Chunk at a given level
+      // Parameters: An int for the level
+      // Preconditions: 0 <= level < height_
+      // Postconditions: N/A
+      // Return value: reference to the forward pointer
+      // Functions called: N/A
+      Chunk*& next(int level);
+      Chunk* next(int level) const;
+
+      // Function purpose: To access the items of the Chunk
+      // Parameters: N/A
+      // Preconditions: N/A
+      // Postconditions: N/A
+      // Return value: pointer to the first of count_ items
+      // Functions called: N/A
+      T* items();
+      const T* items() const;
+
+      int height_;
+      int count_;
+      Chunk *prev_;
+      alignas(T) unsigned char storage_[Capacity * sizeof(T)];
+      // height_ forward pointers are stored directly after the Chunk in the same allocation
+   };
+
+   // Unit in which Chunk blocks are requested from the allocator
+   struct ChunkSlot {
+      alignas(Chunk) unsigned char bytes_[alignof(Chunk)];
+   };
+
+   using ChunkAllocator = typename allocator_traits<Allocator>::template rebind_alloc<ChunkSlot>;
+   using ChunkTraits = allocator_traits<ChunkAllocator>;
+
+public:
+
+   // Upper bound on the number of levels
+   static constexpr int MAX_LEVEL = 32;
+
+private:
+
+   ChunkAllocator chunkAlloc_;
+   Compare comp_;
+   LevelGenerator levelGenerator_;
+   int maxLevel_;
+   int size_;
+   int chunks_;
+   Chunk *heads_[MAX_LEVEL];
+   Chunk *tails_[MAX_LEVEL];
+
+   // Function purpose: To allocate an empty Chunk and its forward pointers in a single block
+   // Parameters: The number of levels the Chunk occupies
+   // Preconditions: 0 < height <= maxLevel_
+   // Postconditions: A Chunk that is not linked into any level
+   // Return value: Chunk pointer
+   // Functions called: chunkSlots
+   Chunk* createChunk(int height);
+
+   // Function purpose: To destroy the items of a Chunk and release its block
+   // Parameters: A Chunk pointer
+   // Preconditions: Chunk was returned by createChunk and is no longer linked
+   // Postconditions: The Chunk no longer exists in memory
+   // Return value: void
+   // Functions called: chunkSlots
+   void destroyChunk(Chunk *chunk);
+
+   // Function purpose: To compute how many ChunkSlots a Chunk of a given height occupies
+   // Parameters: An int for the height
+   // Preconditions: height is > 0
+   // Postconditions: N/A
+   // Return value: size_t
+   // Functions called: N/A
+   static size_t chunkSlots(int height);
+
+   // Function purpose: To return the Chunk following a predecessor at a given level
+   // Parameters: A Chunk pointer (nullptr stands for the head of the level) and an int for the level
+   // Preconditions: pred occupies the level if it is not nullptr
+   // Postconditions: N/A
+   // Return value: Chunk pointer
+   // Functions called: N/A
+   Chunk* successor(Chunk *pred, int level) const;
+
+   // Function purpose: To find the last Chunk on every level whose first item is less than an item
+   // Parameters: An item and an array of MAX_LEVEL entries to receive the predecessors, or nullptr
+   // Preconditions: N/A
+   // Postconditions: preds[i], if given, is the last such Chunk on level i (nullptr for the head)
+   // Return value: The last such Chunk on the lowest level, or nullptr
+   // Functions called: successor
+   Chunk* findChunkBefore(const T& data, Chunk **preds) const;
+
+   // Function purpose: To find the position of the first item of a Chunk that is not less than an item
+   // Parameters: A Chunk and an item
+   // Preconditions: chunk is not nullptr and holds at least one item
+   // Postconditions: N/A
+   // Return value: int between 0 and chunk->count_
+   // Functions called: SimdSearch::lowerBound
+   int lowerBoundIn(const Chunk *chunk, const T& data) const;
+
+   // Function purpose: To find the Chunk and position holding an item, if any
+   // Parameters: An item, and an array of MAX_LEVEL entries to receive the predecessors of the Chunk
+   // found, or nullptr
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: pair of the Chunk and position of the first item not less than data; the Chunk is
+   // nullptr if every item is less than data
+   // Functions called: findChunkBefore, lowerBoundIn
+   pair<Chunk*, int> locate(const T& data, Chunk **preds) const;
+
+   // Function purpose: To link a Chunk after its predecessors on every level it occupies
+   // Parameters: The Chunk and predecessors no later than it on every level
+   // Preconditions: The Chunk holds at least one item and is not linked
+   // Postconditions: The Chunk is linked on levels 0 to height_ - 1
+   // Return value: void
+   // Functions called: successor
+   void linkChunk(Chunk *chunk, Chunk **preds);
+
+   // Function purpose: To unlink a Chunk from every level and destroy it
+   // Parameters: The Chunk and its predecessors on every level it occupies
+   // Preconditions: preds[i] is directly before chunk on level i for every level it occupies
+   // Postconditions: The Chunk no longer exists
+   // Return value: void
+   // Functions called: successor, destroyChunk
+   void unlinkChunk(Chunk *chunk, Chunk **preds);
+
+   // Function purpose: To move the upper half of a full Chunk into a new Chunk linked after it
+   // Parameters: The full Chunk and predecessors no later than it on every level
+   // Preconditions: chunk->count_ == Capacity
+   // Postconditions: Both Chunks are half full
+   // Return value: The new Chunk
+   // Functions called: createChunk, randomHeight, linkChunk, growIfNeeded
+   Chunk* splitChunk(Chunk *chunk, Chunk **preds);
+
+   // Function purpose: To move the items of the next Chunk into a sparse Chunk when both fit
+   // Parameters: A Chunk
+   // Preconditions: chunk holds at least one item
+   // Postconditions: The next Chunk is unlinked if its items were moved
+   // Return value: bool that is true if the Chunks were merged
+   // Functions called: findChunkBefore, unlinkChunk
+   bool mergeWithNext(Chunk *chunk);
+
+   // Function purpose: To add or remove an item at a position of a Chunk, shifting the items after it
+   // Parameters: The Chunk, the position and, for insertAt, the item
+   // Preconditions: insertAt: count_ < Capacity and pos <= count_; eraseAt: pos < count_
+   // Postconditions: The items stay contiguous and sorted
+   // Return value: void
+   // Functions called: N/A
+   template<class U>
+   void insertAt(Chunk *chunk, int pos, U&& data);
+   void eraseAt(Chunk *chunk, int pos);
+
+   // Function purpose: To choose the number of levels a new Chunk occupies
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: int between 1 and maxLevel_
+   // Functions called: LevelGenerator::height
+   int randomHeight();
+
+   // Function purpose: To add a level when the number of Chunks outgrows the current levels
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: maxLevel_ is large enough for chunks_ Chunks, or equal to MAX_LEVEL
+   // Return value: void
+   // Functions called: LevelGenerator::capacity
+   void growIfNeeded();
+
+   // Function purpose: To copy the Chunks of another UnrolledSkipList, keeping their heights
+   // Parameters: An UnrolledSkipList
+   // Preconditions: This UnrolledSkipList is empty
+   // Postconditions: Both hold the same items in Chunks of the same sizes and heights
+   // Return value: void
+   // Functions called: createChunk
+   void copyContents(const UnrolledSkipList& toCopy);
+
+public:
+
+   class iterator {
+      public:
+      using iterator_category = std::bidirectional_iterator_tag;
+      using difference_type = std::ptrdiff_t;
+      using value_type = T;
+      using pointer = const T*;
+      using reference = const T&;
+
+      // Function purpose: To construct an iterator for the UnrolledSkipList
+      // Parameters: A pointer to an UnrolledSkipList, a Chunk of it and a position in the Chunk
+      // Preconditions: pos < chunk->count_, or chunk is nullptr for end()
+      // Postconditions: Iterator located at the item
+      // Return value: N/A
+      // Functions called: N/A
+      iterator(const UnrolledSkipList *listPtr = nullptr, Chunk *chunkPtr = nullptr, int pos = 0);
+
+      // Function purpose: To return the item at the iterator
+      // Parameters: N/A
+      // Preconditions: The iterator is not at end()
+      // Postconditions: N/A
+      // Return value: const reference to the item
+      // Functions called: N/A
+      const T& operator*() const;
+      const T* operator->() const;
+
+      // Function purpose: To move the iterator to the next or previous item
+      // Parameters: N/A
+      // Preconditions: The iterator is not at end() (increment) or begin() (decrement)
+      // Postconditions: Moved iterator; moving past the last item of a Chunk goes to the next Chunk
+      // Return value: iterator
+      // Functions called: N/A
+      iterator& operator++();
+      iterator operator++(int);
+      iterator& operator--();
+      iterator operator--(int);
+
+      // Function purpose: To determine whether two iterators are at the same item
+      // Parameters: An iterator
+      // Preconditions: N/A
+      // Postconditions: N/A
+      // Return value: bool
+      // Functions called: N/A
+      bool operator==(const iterator& rhs) const;
+      bool operator!=(const iterator& rhs) const;
+
+      private:
+      const UnrolledSkipList *listPtr_;
+      Chunk *chunkPtr_;
+      int pos_;
+   };
+
+   using const_iterator = iterator;
+
+   // Function purpose: To initialize an empty UnrolledSkipList
+   // Parameters: The comparator and the allocator
+   // Preconditions: N/A
+   // Postconditions: An initialized UnrolledSkipList
+   // Return value: N/A
+   // Functions called: N/A
+   explicit UnrolledSkipList(const Compare& comp = Compare(), const Allocator& alloc = Allocator());
+
+   // Function purpose: To initialize an UnrolledSkipList using initializer_list
+   // Parameters: An initialization list, the comparator and the allocator
+   // Preconditions: N/A
+   // Postconditions: An UnrolledSkipList holding each distinct item of the list
+   // Return value: N/A
+   // Functions called: insert
+   UnrolledSkipList(initializer_list<T> vals, const Compare& comp = Compare(), const Allocator& alloc = Allocator());
+
+   // Function purpose: To copy or move an UnrolledSkipList
+   // Parameters: An UnrolledSkipList
+   // Preconditions: N/A
+   // Postconditions: A copy of the parameter, or the contents of the parameter, which is left empty
+   // Return value: N/A (reference to this object for the assignments)
+   // Functions called: copyContents, clear
+   UnrolledSkipList(const UnrolledSkipList& toCopy);
+   UnrolledSkipList(UnrolledSkipList&& toMove) noexcept;
+   UnrolledSkipList& operator=(const UnrolledSkipList& rhs);
+   UnrolledSkipList& operator=(UnrolledSkipList&& rhs);
+
+   // Function purpose: To destroy an UnrolledSkipList
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: Every Chunk has been released
+   // Return value: N/A
+   // Functions called: clear
+   ~UnrolledSkipList();
+
+   // Function purpose: To add an item unless an equal item is present
+   // Parameters: An item to copy or move into the UnrolledSkipList
+   // Preconditions: N/A
+   // Postconditions: The item is in the UnrolledSkipList
+   // Return value: pair of an iterator to the item and a bool that is true if the item was inserted
+   // Functions called: findChunkBefore, lowerBoundIn, splitChunk, insertAt, createChunk, linkChunk
+   pair<iterator, bool> insert(const T& data);
+   pair<iterator, bool> insert(T&& data);
+
+   // Function purpose: To remove an item
+   // Parameters: An item
+   // Preconditions: N/A
+   // Postconditions: The item is no longer in the UnrolledSkipList
+   // Return value: int for the number of items removed (0 or 1)
+   // Functions called: locate, eraseAt, unlinkChunk, mergeWithNext
+   int erase(const T& data);
+
+   // Function purpose: To check if the UnrolledSkipList contains an item
+   // Parameters: An item
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: bool
+   // Functions called: locate
+   bool contains(const T& data) const;
+
+   // Function purpose: To locate an item, or the first item that is not less than it
+   // Parameters: An item
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: iterator, or end() if there is no such item
+   // Functions called: locate
+   iterator find(const T& data) const;
+   iterator lower_bound(const T& data) const;
+
+   // Function purpose: To check the structure of the UnrolledSkipList
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: bool that is true if no Chunk is empty or over Capacity, every item is greater than the
+   // one before it, every level is a subsequence of the level below and prev_, heads_, tails_, size_ and
+   // chunks_ agree with the links
+   // Functions called: N/A
+   bool validate() const;
+
+   // Function purpose: To return the number of items or whether there are none
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: int / bool
+   // Functions called: N/A
+   int size() const;
+   bool empty() const;
+
+   // Function purpose: To remove every item
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: Empty UnrolledSkipList; every Chunk has been released in one pass over the lowest level
+   // Return value: void
+   // Functions called: destroyChunk
+   void clear();
+
+   // Function purpose: To return iterators to the first item and past the last item
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: iterator
+   // Functions called: N/A
+   iterator begin() const;
+   iterator end() const;
+
+private:
+
+   // Function purpose: To add an item unless an equal item is present
+   // Parameters: An item, forwarded so that an rvalue is moved into its slot
+   // Preconditions: N/A
+   // Postconditions: The item is in the UnrolledSkipList; data is left untouched if it already was
+   // Return value: pair of an iterator to the item and a bool that is true if the item was inserted
+   // Functions called: findChunkBefore, lowerBoundIn, splitChunk, insertAt, createChunk, linkChunk
+   template<class U>
+   pair<iterator, bool> insertUnique(U&& data);
+};
+
+#include "UnrolledSkipList.cpp"
@@ -0,0 +1,671 @@
+/*
+SkipListBenchmark.cpp
+
+Input & output: Measures SkipList, UnrolledSkipList, SkipMap and ConcurrentSkipList against std::set,
+std::map and a sorted vector and prints one record per measurement, in the JSON layout of Google Benchmark
+(default) or as CSV.
+Each record names the container, key type, access pattern, operation, size and thread count, and gives the
+number of operations timed and the mean wall-clock time per operation in nanoseconds.
+Program use:
+From this directory:
+g++ -std=c++17 -O2 -DNDEBUG -I.. SkipListBenchmark.cpp -o SkipListBenchmark -lpthread
+Add -mavx2 (or -march=native) to measure the AVX2 in-node search of UnrolledSkipList.
+./SkipListBenchmark [--format=json|csv] [--min-size=N] [--max-size=N] [--keys=int,uint64,string]
+   [--patterns=sequential,uniform,zipfian] [--threads=1,2,4,8] [--filter=text]
+Sizes are the powers of ten from --min-size (1000 by default) to --max-size (1000000 by default; pass
+--max-size=10000000 for the largest runs). --filter keeps the records whose name contains the text, e.g.
+--filter=SkipList/int/uniform. Thread counts above the number of hardware threads are skipped.
+Operations:
+insert - add every key to an empty container, in the order of the pattern
+contains_hit / contains_miss - look up keys that are present / absent, drawn by the pattern
+erase - remove every key from a full container, in the order of the pattern
+iterate - visit every item in order
+range_scan_100 - lower_bound on a key drawn by the pattern, then visit the next 100 items
+copy - copy construct the full container
+clear - remove every item with clear()
+Assumptions:
+The sorted vector keeps its items ordered by inserting and erasing in place, so its insert and erase are
+only measured up to 100000 items; its other operations start from a vector filled by one sort. The
+threaded records use int keys and the uniform pattern, and compare ConcurrentSkipList with a std::set
+behind one mutex.
+Description:
+The present keys are the even values 0, 2, ..., 2(n - 1) converted to the key type, and the missing keys
+are the odd values in between, so a miss lands between two present keys. The sequential pattern inserts
+and queries in increasing order, uniform shuffles the insertion order and draws queries uniformly, and
+zipfian draws queries from a Zipf distribution (theta = 0.99) over a shuffled ranking of the keys. Small
+sizes are repeated until about REPEAT_ITEMS operations have been timed; setup between repetitions is not
+timed.
+*/
+
+#include "SkipList.h"
+#include "SkipMap.h"
+#include "UnrolledSkipList.h"
+#include "ConcurrentSkipList.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// Number of operations a measurement is repeated up to, so that small sizes are timed over enough work
+static constexpr long REPEAT_ITEMS = 1L << 20;
+// Upper bound on the number of lookups and scans timed per measurement
+static constexpr long MAX_QUERIES = 1L << 20;
+static constexpr long MAX_SCANS = 1L << 16;
+static constexpr int SCAN_LENGTH = 100;
+// Largest size at which the sorted vector inserts and erases in place
+static constexpr long VECTOR_EDIT_LIMIT = 100000;
+
+struct Options {
+   string format = "json";
+   long minSize = 1000;
+   long maxSize = 1000000;
+   vector<string> keys = {"int", "uint64", "string"};
+   vector<string> patterns = {"sequential", "uniform", "zipfian"};
+   vector<int> threads = {1, 2, 4, 8};
+   string filter;
+};
+
+struct Record {
+   string name;
+   string container;
+   string key;
+   string pattern;
+   string operation;
+   long size;
+   int threads;
+   long iterations;
+   double nsPerOp;
+};
+
+// Function purpose: To keep the compiler from discarding a computed value
+// Parameters: The value
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: void
+// Functions called: N/A
+template<class V>
+inline void keep(const V& value) {
+   asm volatile("" : : "g"(value) : "memory");
+}
+
+// Function purpose: To convert one of the generated values to a key
+// Parameters: A value below 2^32
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: The key; keys compare in the same order as their values
+// Functions called: N/A
+template<class K>
+K makeKey(uint64_t value);
+
+template<>
+int makeKey<int>(uint64_t value) {
+   return static_cast<int>(value);
+}
+
+template<>
+uint64_t makeKey<uint64_t>(uint64_t value) {
+   return value + (uint64_t(1) << 40);
+}
+
+template<>
+string makeKey<string>(uint64_t value) {
+   // Zero padding keeps the lexicographic order equal to the numeric order; the length defeats the
+   // small string optimization, as real string keys usually do
+   char buffer[32];
+   snprintf(buffer, sizeof(buffer), "user:%016llu", static_cast<unsigned long long>(value));
+   return string(buffer);
+}
+
+// Function purpose: To reduce an item to a number that a traversal can accumulate
+// Parameters: An item or an entry of a map
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: uint64_t
+// Functions called: N/A
+inline uint64_t weigh(int item) { return static_cast<uint64_t>(item); }
+inline uint64_t weigh(uint64_t item) { return item; }
+inline uint64_t weigh(const string& item) { return item.size(); }
+template<class K, class V>
+inline uint64_t weigh(const pair<const K, V>& entry) { return weigh(entry.first); }
+
+// Draws ranks from a Zipf distribution with the method of Gray et al., as used by YCSB
+class ZipfianGenerator {
+public:
+
+   // Function purpose: To initialize a ZipfianGenerator
+   // Parameters: The number of ranks, the skew and the seed
+   // Preconditions: items > 1; 0 < theta < 1
+   // Postconditions: An initialized ZipfianGenerator
+   // Return value: N/A
+   // Functions called: N/A
+   ZipfianGenerator(uint64_t items, double theta, uint64_t seed) : items_(items), theta_(theta), random_(seed) {
+      zetaN_ = 0.0;
+      for (uint64_t i = 1; i <= items; i++) { zetaN_ += 1.0 / pow(static_cast<double>(i), theta); }
+      double zeta2 = 1.0 + pow(0.5, theta);
+      alpha_ = 1.0 / (1.0 - theta);
+      eta_ = (1.0 - pow(2.0 / static_cast<double>(items), 1.0 - theta)) / (1.0 - zeta2 / zetaN_);
+   }
+
+   // Function purpose: To draw the next rank
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: The generator has advanced
+   // Return value: uint64_t below items; rank 0 is the most frequent
+   // Functions called: N/A
+   uint64_t next() {
+      double u = uniform_real_distribution<double>(0.0, 1.0)(random_);
+      double uz = u * zetaN_;
+      if (uz < 1.0) { return 0; }
+      if (uz < 1.0 + pow(0.5, theta_)) { return 1; }
+      uint64_t rank = static_cast<uint64_t>(items_ * pow(eta_ * u - eta_ + 1.0, alpha_));
+      return (rank < items_) ? rank : items_ - 1;
+   }
+
+private:
+   uint64_t items_;
+   double theta_;
+   double zetaN_;
+   double alpha_;
+   double eta_;
+   mt19937_64 random_;
+};
+
+// The keys of one size, key type and pattern, in the order in which they are inserted and queried
+template<class K>
+struct Workload {
+   string keyName;
+   string pattern;
+   long size;
+   vector<K> insertOrder;
+   vector<K> hits;
+   vector<K> misses;
+   vector<K> scanStarts;
+};
+
+// Function purpose: To generate the keys of a workload
+// Parameters: The name of the key type, the pattern and the number of keys
+// Preconditions: pattern is sequential, uniform or zipfian; size > 1
+// Postconditions: N/A
+// Return value: Workload
+// Functions called: makeKey, ZipfianGenerator::next
+template<class K>
+Workload<K> makeWorkload(const string& keyName, const string& pattern, long size) {
+   Workload<K> work;
+   work.keyName = keyName;
+   work.pattern = pattern;
+   work.size = size;
+   mt19937_64 random(size * 31 + pattern.size());
+
+   vector<uint64_t> order(size);
+   for (long i = 0; i < size; i++) { order[i] = i; }
+   if (pattern != "sequential") { shuffle(order.begin(), order.end(), random); }
+   work.insertOrder.reserve(size);
+   for (long i = 0; i < size; i++) { work.insertOrder.push_back(makeKey<K>(2 * order[i])); }
+
+   long queries = min<long>(max<long>(size, REPEAT_ITEMS / 4), MAX_QUERIES);
+   long scans = min<long>(size, MAX_SCANS);
+   vector<uint64_t> ranks(queries);
+   if (pattern == "sequential") {
+      for (long i = 0; i < queries; i++) { ranks[i] = i % size; }
+   }
+   else if (pattern == "uniform") {
+      uniform_int_distribution<uint64_t> pick(0, size - 1);
+      for (long i = 0; i < queries; i++) { ranks[i] = pick(random); }
+   }
+   else {
+      // The most frequent ranks are spread over the key space through the shuffled order
+      ZipfianGenerator zipf(size, 0.99, random());
+      for (long i = 0; i < queries; i++) { ranks[i] = order[zipf.next()]; }
+   }
+   work.hits.reserve(queries);
+   work.misses.reserve(queries);
+   for (long i = 0; i < queries; i++) {
+      work.hits.push_back(makeKey<K>(2 * ranks[i]));
+      work.misses.push_back(makeKey<K>(2 * ranks[i] + 1));
+   }
+   for (long i = 0; i < scans; i++) { work.scanStarts.push_back(work.hits[i]); }
+   return work;
+}
+
+// A std::vector kept in sorted order, used as the cache-friendly baseline
+template<class K>
+class SortedVector {
+public:
+   using iterator = typename vector<K>::const_iterator;
+
+   // Function purpose: To insert, find or erase an item by binary search
+   // Parameters: The item
+   // Preconditions: N/A
+   // Postconditions: The vector is still sorted and free of duplicates
+   // Return value: As for std::set
+   // Functions called: N/A
+   void insert(const K& item) {
+      auto it = std::lower_bound(items_.begin(), items_.end(), item);
+      if (it == items_.end() || item < *it) { items_.insert(it, item); }
+   }
+   iterator find(const K& item) const {
+      auto it = std::lower_bound(items_.begin(), items_.end(), item);
+      return (it != items_.end() && !(item < *it)) ? it : items_.end();
+   }
+   iterator lower_bound(const K& item) const { return std::lower_bound(items_.begin(), items_.end(), item); }
+   int erase(const K& item) {
+      auto it = std::lower_bound(items_.begin(), items_.end(), item);
+      if (it == items_.end() || item < *it) { return 0; }
+      items_.erase(it);
+      return 1;
+   }
+
+   // Function purpose: To replace the contents with a range of items in one sort
+   // Parameters: Iterators to the first and past the last item
+   // Preconditions: N/A
+   // Postconditions: The vector holds the unique items of the range in sorted order
+   // Return value: void
+   // Functions called: N/A
+   template<class InputIt>
+   void assign(InputIt first, InputIt last) {
+      items_.assign(first, last);
+      sort(items_.begin(), items_.end());
+      items_.erase(unique(items_.begin(), items_.end()), items_.end());
+   }
+
+   iterator begin() const { return items_.begin(); }
+   iterator end() const { return items_.end(); }
+   void clear() { items_.clear(); }
+
+private:
+   vector<K> items_;
+};
+
+// A SkipList whose nodes are promoted with probability 1/4 instead of 1/2
+template<class K>
+class QuarterSkipList : public SkipList<K> {
+public:
+   QuarterSkipList() : SkipList<K>(1, LevelGenerator(LevelGenerator::QUARTER)) {}
+};
+
+// Operations on containers that store bare keys
+struct SetOps {
+   template<class C, class K>
+   static void insert(C& container, const K& key) { container.insert(key); }
+   template<class C, class K>
+   static void fill(C& container, const vector<K>& keys) {
+      for (const K &key : keys) { container.insert(key); }
+   }
+   template<class K>
+   static void fill(SortedVector<K>& container, const vector<K>& keys) { container.assign(keys.begin(), keys.end()); }
+};
+
+// Operations on maps from a key to a count
+struct MapOps {
+   template<class C, class K>
+   static void insert(C& container, const K& key) { container.try_emplace(key, 1); }
+   template<class C, class K>
+   static void fill(C& container, const vector<K>& keys) {
+      for (const K &key : keys) { container.try_emplace(key, 1); }
+   }
+};
+
+// Collects records and decides which measurements to run
+class Report {
+public:
+
+   // Function purpose: To initialize a Report
+   // Parameters: The command line options
+   // Preconditions: N/A
+   // Postconditions: An empty Report
+   // Return value: N/A
+   // Functions called: N/A
+   explicit Report(const Options& options) : options_(options) {}
+
+   // Function purpose: To build the name of a measurement and check it against --filter
+   // Parameters: The fields of the record
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: bool that is true if the measurement should run
+   // Functions called: nameOf
+   bool wanted(const string& container, const string& key, const string& pattern, const string& operation,
+         long size, int threads) const {
+      return options_.filter.empty() ||
+         nameOf(container, key, pattern, operation, size, threads).find(options_.filter) != string::npos;
+   }
+
+   // Function purpose: To add a record
+   // Parameters: The fields of the record, the number of operations timed and the total time
+   // Preconditions: iterations > 0
+   // Postconditions: The record is kept for print
+   // Return value: void
+   // Functions called: nameOf
+   void add(const string& container, const string& key, const string& pattern, const string& operation,
+         long size, int threads, long iterations, double totalNs) {
+      records_.push_back({nameOf(container, key, pattern, operation, size, threads), container, key, pattern,
+         operation, size, threads, iterations, totalNs / iterations});
+      fprintf(stderr, "%-60s %12.1f ns\n", records_.back().name.c_str(), records_.back().nsPerOp);
+   }
+
+   // Function purpose: To write every record to stdout
+   // Parameters: N/A
+   // Preconditions: N/A
+   // Postconditions: The records are printed as JSON or CSV according to --format
+   // Return value: void
+   // Functions called: N/A
+   void print() const {
+      if (options_.format == "csv") {
+         printf("name,container,key,pattern,operation,size,threads,iterations,ns_per_op\n");
+         for (const Record &r : records_) {
+            printf("%s,%s,%s,%s,%s,%ld,%d,%ld,%.3f\n", r.name.c_str(), r.container.c_str(), r.key.c_str(),
+               r.pattern.c_str(), r.operation.c_str(), r.size, r.threads, r.iterations, r.nsPerOp);
+         }
+         return;
+      }
+      char date[64];
+      time_t now = time(nullptr);
+      strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+      printf("{\n  \"context\": {\n");
+      printf("    \"date\": \"%s\",\n", date);
+      printf("    \"num_cpus\": %u,\n", thread::hardware_concurrency());
+      printf("    \"compiler\": \"%s\",\n", __VERSION__);
+#ifdef NDEBUG
+      printf("    \"library_build_type\": \"release\"\n");
+#else
+      printf("    \"library_build_type\": \"debug\"\n");
+#endif
+      printf("  },\n  \"benchmarks\": [\n");
+      for (size_t i = 0; i < records_.size(); i++) {
+         const Record &r = records_[i];
+         printf("    {\n");
+         printf("      \"name\": \"%s\",\n", r.name.c_str());
+         printf("      \"container\": \"%s\",\n", r.container.c_str());
+         printf("      \"key\": \"%s\",\n", r.key.c_str());
+         printf("      \"pattern\": \"%s\",\n", r.pattern.c_str());
+         printf("      \"operation\": \"%s\",\n", r.operation.c_str());
+         printf("      \"size\": %ld,\n", r.size);
+         printf("      \"threads\": %d,\n", r.threads);
+         printf("      \"iterations\": %ld,\n", r.iterations);
+         printf("      \"real_time\": %.3f,\n", r.nsPerOp);
+         printf("      \"time_unit\": \"ns\"\n");
+         printf("    }%s\n", (i + 1 < records_.size()) ? "," : "");
+      }
+      printf("  ]\n}\n");
+   }
+
+private:
+
+   // Function purpose: To build the name of a record
+   // Parameters: The fields of the record
+   // Preconditions: N/A
+   // Postconditions: N/A
+   // Return value: string of the form container/key/pattern/operation/size/threads:n
+   // Functions called: N/A
+   static string nameOf(const string& container, const string& key, const string& pattern,
+         const string& operation, long size, int threads) {
+      return container + "/" + key + "/" + pattern + "/" + operation + "/" + to_string(size) + "/threads:" +
+         to_string(threads);
+   }
+
+   const Options &options_;
+   vector<Record> records_;
+};
+
+// Function purpose: To time an operation, repeating it until about REPEAT_ITEMS operations have been timed
+// Parameters: The number of operations in one run, an untimed setup called before each run and the run
+// Preconditions: items > 0
+// Postconditions: N/A
+// Return value: pair of the number of operations timed and the total time in nanoseconds
+// Functions called: N/A
+template<class Setup, class Run>
+pair<long, double> measure(long items, Setup setup, Run run) {
+   long repetitions = max<long>(1, REPEAT_ITEMS / items);
+   double totalNs = 0.0;
+   for (long i = 0; i < repetitions; i++) {
+      setup();
+      auto start = chrono::steady_clock::now();
+      run();
+      auto stop = chrono::steady_clock::now();
+      totalNs += chrono::duration<double, nano>(stop - start).count();
+   }
+   return make_pair(items * repetitions, totalNs);
+}
+
+// Function purpose: To run every single-threaded operation on one container type
+// Parameters: The name of the container, the workload and the report
+// Preconditions: N/A
+// Postconditions: One record per operation that is wanted has been added to the report
+// Return value: void
+// Functions called: measure, Report::wanted, Report::add
+template<class C, class Ops, class K>
+void runContainer(const string& name, const Workload<K>& work, Report& report) {
+   const bool isVector = is_same<C, SortedVector<K>>::value;
+   auto wanted = [&](const char *operation) {
+      return report.wanted(name, work.keyName, work.pattern, operation, work.size, 1);
+   };
+   auto record = [&](const char *operation, pair<long, double> result) {
+      report.add(name, work.keyName, work.pattern, operation, work.size, 1, result.first, result.second);
+   };
+   unique_ptr<C> container;
+   auto fresh = [&]() { container.reset(new C()); };
+   auto full = [&]() { container.reset(new C()); Ops::fill(*container, work.insertOrder); };
+
+   if (wanted("insert") && (!isVector || work.size <= VECTOR_EDIT_LIMIT)) {
+      record("insert", measure(work.size, fresh, [&]() {
+         for (const K &key : work.insertOrder) { Ops::insert(*container, key); }
+      }));
+   }
+   if (wanted("erase") && (!isVector || work.size <= VECTOR_EDIT_LIMIT)) {
+      record("erase", measure(work.size, full, [&]() {
+         for (const K &key : work.insertOrder) { container->erase(key); }
+      }));
+   }
+   if (wanted("clear")) {
+      record("clear", measure(work.size, full, [&]() { container->clear(); }));
+   }
+
+   full();
+   const C &filled = *container;
+   if (wanted("contains_hit")) {
+      long queries = work.hits.size();
+      record("contains_hit", measure(queries, []() {}, [&]() {
+         long found = 0;
+         for (const K &key : work.hits) { found += (filled.find(key) != filled.end()); }
+         keep(found);
+      }));
+   }
+   if (wanted("contains_miss")) {
+      long queries = work.misses.size();
+      record("contains_miss", measure(queries, []() {}, [&]() {
+         long found = 0;
+         for (const K &key : work.misses) { found += (filled.find(key) != filled.end()); }
+         keep(found);
+      }));
+   }
+   if (wanted("iterate")) {
+      record("iterate", measure(work.size, []() {}, [&]() {
+         uint64_t sum = 0;
+         for (const auto &item : filled) { sum += weigh(item); }
+         keep(sum);
+      }));
+   }
+   if (wanted("range_scan_100")) {
+      long scans = work.scanStarts.size();
+      record("range_scan_100", measure(scans, []() {}, [&]() {
+         uint64_t sum = 0;
+         for (const K &key : work.scanStarts) {
+            auto it = filled.lower_bound(key);
+            for (int i = 0; i < SCAN_LENGTH && it != filled.end(); i++, ++it) { sum += weigh(*it); }
+         }
+         keep(sum);
+      }));
+   }
+   if (wanted("copy")) {
+      unique_ptr<C> copy;
+      record("copy", measure(work.size, [&]() { copy.reset(); }, [&]() { copy.reset(new C(filled)); }));
+   }
+}
+
+// Function purpose: To run the single-threaded operations of every container for one key type
+// Parameters: The name of the key type, the options and the report
+// Preconditions: N/A
+// Postconditions: Records for every size and pattern have been added to the report
+// Return value: void
+// Functions called: makeWorkload, runContainer
+template<class K>
+void runKeyType(const string& keyName, const Options& options, Report& report) {
+   for (long size = options.minSize; size <= options.maxSize; size *= 10) {
+      for (const string &pattern : options.patterns) {
+         Workload<K> work = makeWorkload<K>(keyName, pattern, size);
+         runContainer<SkipList<K>, SetOps>("SkipList", work, report);
+         runContainer<QuarterSkipList<K>, SetOps>("SkipList_p0.25", work, report);
+         runContainer<UnrolledSkipList<K>, SetOps>("UnrolledSkipList", work, report);
+         runContainer<set<K>, SetOps>("std::set", work, report);
+         runContainer<SortedVector<K>, SetOps>("SortedVector", work, report);
+         runContainer<SkipMap<K, int>, MapOps>("SkipMap", work, report);
+         runContainer<map<K, int>, MapOps>("std::map", work, report);
+      }
+   }
+}
+
+// Function purpose: To time one operation run by several threads at once
+// Parameters: The number of threads and a function called with the index of each thread
+// Preconditions: threads > 0
+// Postconditions: Every thread has finished
+// Return value: double for the wall-clock time in nanoseconds from the common start to the last finish
+// Functions called: N/A
+template<class Work>
+double timeThreads(int threads, Work work) {
+   atomic<int> ready(0);
+   atomic<bool> go(false);
+   vector<thread> pool;
+   for (int t = 0; t < threads; t++) {
+      pool.emplace_back([&, t]() {
+         ready.fetch_add(1);
+         while (!go.load(memory_order_acquire)) { this_thread::yield(); }
+         work(t);
+      });
+   }
+   while (ready.load() < threads) { this_thread::yield(); }
+   auto start = chrono::steady_clock::now();
+   go.store(true, memory_order_release);
+   for (thread &worker : pool) { worker.join(); }
+   return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+}
+
+// A std::set guarded by one mutex, the usual way to share an ordered set between threads
+class LockedSet {
+public:
+   void insert(int key) { lock_guard<mutex> guard(lock_); items_.insert(key); }
+   bool contains(int key) { lock_guard<mutex> guard(lock_); return items_.count(key) != 0; }
+private:
+   mutex lock_;
+   set<int> items_;
+};
+
+// Function purpose: To run the threaded inserts and lookups on one container type
+// Parameters: The name of the container, the workload, the number of threads and the report
+// Preconditions: threads > 0
+// Postconditions: One record per operation that is wanted has been added to the report
+// Return value: void
+// Functions called: timeThreads, Report::wanted, Report::add
+template<class C>
+void runThreaded(const string& name, const Workload<int>& work, int threads, Report& report) {
+   long size = work.size;
+   if (report.wanted(name, work.keyName, work.pattern, "insert", size, threads)) {
+      // Each thread inserts its own slice of the keys
+      C container;
+      double ns = timeThreads(threads, [&](int t) {
+         for (long i = t; i < size; i += threads) { container.insert(work.insertOrder[i]); }
+      });
+      report.add(name, work.keyName, work.pattern, "insert", size, threads, size, ns);
+   }
+   if (report.wanted(name, work.keyName, work.pattern, "contains_hit", size, threads)) {
+      C container;
+      for (int key : work.insertOrder) { container.insert(key); }
+      long queries = work.hits.size();
+      double ns = timeThreads(threads, [&](int t) {
+         long found = 0;
+         for (long i = t; i < queries; i += threads) { found += container.contains(work.hits[i]); }
+         keep(found);
+      });
+      report.add(name, work.keyName, work.pattern, "contains_hit", size, threads, queries, ns);
+   }
+}
+
+// Function purpose: To split a comma-separated list
+// Parameters: The text
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: vector of the non-empty fields
+// Functions called: N/A
+vector<string> splitList(const string& text) {
+   vector<string> fields;
+   stringstream stream(text);
+   string field;
+   while (getline(stream, field, ',')) {
+      if (!field.empty()) { fields.push_back(field); }
+   }
+   return fields;
+}
+
+// Function purpose: To read the command line
+// Parameters: The arguments of main
+// Preconditions: N/A
+// Postconditions: N/A
+// Return value: Options; unknown arguments are reported on stderr and ignored
+// Functions called: splitList
+Options parseOptions(int argc, char **argv) {
+   Options options;
+   for (int i = 1; i < argc; i++) {
+      string arg = argv[i];
+      size_t equals = arg.find('=');
+      string flag = arg.substr(0, equals);
+      string value = (equals == string::npos) ? "" : arg.substr(equals + 1);
+      if (flag == "--format") { options.format = value; }
+      else if (flag == "--min-size") { options.minSize = max(2L, stol(value)); }
+      else if (flag == "--max-size") { options.maxSize = stol(value); }
+      else if (flag == "--keys") { options.keys = splitList(value); }
+      else if (flag == "--patterns") { options.patterns = splitList(value); }
+      else if (flag == "--filter") { options.filter = value; }
+      else if (flag == "--threads") {
+         options.threads.clear();
+         for (const string &count : splitList(value)) { options.threads.push_back(stoi(count)); }
+      }
+      else { fprintf(stderr, "Ignoring unknown argument %s\n", arg.c_str()); }
+   }
+   return options;
+}
+
+int main(int argc, char **argv) {
+   Options options = parseOptions(argc, argv);
+   Report report(options);
+
+   for (const string &key : options.keys) {
+      if (key == "int") { runKeyType<int>(key, options, report); }
+      else if (key == "uint64") { runKeyType<uint64_t>(key, options, report); }
+      else if (key == "string") { runKeyType<string>(key, options, report); }
+   }
+
+   int hardwareThreads = max(1u, thread::hardware_concurrency());
+   for (long size = options.minSize; size <= options.maxSize; size *= 10) {
+      Workload<int> work = makeWorkload<int>("int", "uniform", size);
+      for (int threads : options.threads) {
+         if (threads < 1 || threads > hardwareThreads) { continue; }
+         runThreaded<ConcurrentSkipList<int>>("ConcurrentSkipList", work, threads, report);
+         runThreaded<LockedSet>("std::set+mutex", work, threads, report);
+      }
+   }
+
+   report.print();
+   return 0;
+}